@@ -0,0 +1,128 @@
+/****************************************************************/
+/*                                                              */
+/*                     Advanced Navigation                      */
+/*                    Benchmark Support Code                    */
+/*         Copyright 2023, Advanced Navigation Pty Ltd          */
+/*                                                              */
+/****************************************************************/
+/*
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef BENCH_COMMON_H_
+#define BENCH_COMMON_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "an_packet_protocol.h"
+
+/*
+ * Monotonic time in nanoseconds
+ */
+static inline uint64_t bench_now(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t) now.tv_sec * 1000000000ULL + (uint64_t) now.tv_nsec;
+}
+
+/*
+ * xorshift64 generator so every run produces the same streams
+ */
+static inline uint64_t bench_random(uint64_t* state)
+{
+	*state ^= *state << 13;
+	*state ^= *state >> 7;
+	*state ^= *state << 17;
+	return *state;
+}
+
+/*
+ * Growable byte stream
+ */
+typedef struct
+{
+	uint8_t* data;
+	size_t length;
+	size_t capacity;
+} bench_stream_t;
+
+static inline void bench_stream_reserve(bench_stream_t* stream, size_t length)
+{
+	if(stream->length + length <= stream->capacity) return;
+	while(stream->length + length > stream->capacity) stream->capacity = stream->capacity ? stream->capacity * 2 : 65536;
+	stream->data = (uint8_t*) realloc(stream->data, stream->capacity);
+	if(stream->data == NULL) abort();
+}
+
+static inline void bench_stream_free(bench_stream_t* stream)
+{
+	free(stream->data);
+	memset(stream, 0, sizeof(bench_stream_t));
+}
+
+/*
+ * Function to append an encoded packet with a random payload to a stream
+ */
+static inline void bench_stream_append_packet(bench_stream_t* stream, uint8_t id, uint8_t length, uint64_t* state)
+{
+	an_packet_view_t an_packet_view;
+	uint8_t i;
+
+	bench_stream_reserve(stream, AN_PACKET_HEADER_SIZE + length);
+	an_packet_view_initialise(&an_packet_view, &stream->data[stream->length], AN_PACKET_HEADER_SIZE + length, length, id);
+	for(i = 0; i < length; i++) an_packet_view.data[i] = (uint8_t) bench_random(state);
+	an_packet_view_encode(&an_packet_view);
+	stream->length += AN_PACKET_HEADER_SIZE + length;
+}
+
+/*
+ * Function to append random bytes to a stream
+ */
+static inline void bench_stream_append_garbage(bench_stream_t* stream, size_t length, uint64_t* state)
+{
+	size_t i;
+	bench_stream_reserve(stream, length);
+	for(i = 0; i < length; i++) stream->data[stream->length + i] = (uint8_t) bench_random(state);
+	stream->length += length;
+}
+
+static inline int bench_compare_uint32(const void* a, const void* b)
+{
+	uint32_t x = *(const uint32_t*) a;
+	uint32_t y = *(const uint32_t*) b;
+	return (x > y) - (x < y);
+}
+
+/*
+ * Function to read a percentile from a sorted sample array
+ */
+static inline uint32_t bench_percentile(const uint32_t* samples, size_t count, double percentile)
+{
+	size_t index;
+	if(count == 0) return 0;
+	index = (size_t) (percentile / 100.0 * (double) (count - 1) + 0.5);
+	return samples[index];
+}
+
+#endif
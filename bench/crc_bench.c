@@ -0,0 +1,131 @@
+/****************************************************************/
+/*                                                              */
+/*                     Advanced Navigation                      */
+/*                       CRC16 Benchmark                        */
+/*         Copyright 2023, Advanced Navigation Pty Ltd          */
+/*                                                              */
+/****************************************************************/
+/*
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+
+/*
+ * Compares calculate_crc16() against the bytewise crc16_table loop it
+ * replaced. Every payload size from 5 to 255 bytes is checked for identical
+ * results, then timed and reported in bytes/ns.
+ *
+ * Usage: crc_bench [-n calls per size]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench_common.h"
+#include "an_packet_protocol.h"
+
+#define BENCH_CALLS_DEFAULT 200000
+#define BENCH_BUFFER_COUNT 64
+
+uint16_t calculate_crc16(const void* data, uint16_t length);
+
+/*
+ * The original one byte per iteration implementation
+ */
+static uint16_t calculate_crc16_bytewise(const void* data, uint16_t length)
+{
+	const uint8_t* bytes = (const uint8_t*) data;
+	uint16_t crc = 0xFFFF, i;
+	for(i = 0; i < length; i++)
+	 {
+		crc = (uint16_t) ((crc << 8) ^ crc16_table[(crc >> 8) ^ bytes[i]]);
+	}
+	return crc;
+}
+
+typedef uint16_t (*crc_function_t)(const void* data, uint16_t length);
+
+/*
+ * Function to time calls of a CRC function over buffers of one size
+ * Returns the throughput in bytes/ns
+ */
+static double time_crc(crc_function_t crc_function, uint8_t buffers[][AN_MAXIMUM_PACKET_SIZE], uint16_t length, int calls, volatile uint16_t* sink)
+{
+	uint64_t start, elapsed;
+	uint16_t crc = 0;
+	int i;
+
+	start = bench_now();
+	for(i = 0; i < calls; i++) crc ^= crc_function(buffers[i % BENCH_BUFFER_COUNT], length);
+	elapsed = bench_now() - start;
+	*sink = crc;
+	return (double) length * calls / (double) elapsed;
+}
+
+int main(int argc, char* argv[])
+{
+	static uint8_t buffers[BENCH_BUFFER_COUNT][AN_MAXIMUM_PACKET_SIZE];
+	volatile uint16_t sink;
+	uint64_t state = 0x9E3779B97F4A7C15ULL;
+	int calls = BENCH_CALLS_DEFAULT;
+	double bytewise, sliced, bytewise_total = 0.0, sliced_total = 0.0;
+	int i, j, sizes = 0;
+	uint16_t length;
+
+	if(argc == 3 && strcmp(argv[1], "-n") == 0) calls = atoi(argv[2]);
+	if((argc != 1 && argc != 3) || calls <= 0)
+	 {
+		fprintf(stderr, "usage: %s [-n calls per size]\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	for(i = 0; i < BENCH_BUFFER_COUNT; i++)
+	 {
+		for(j = 0; j < AN_MAXIMUM_PACKET_SIZE; j++) buffers[i][j] = (uint8_t) bench_random(&state);
+	}
+
+	for(length = 0; length <= AN_MAXIMUM_PACKET_SIZE; length++)
+	 {
+		for(i = 0; i < BENCH_BUFFER_COUNT; i++)
+		 {
+			if(calculate_crc16(buffers[i], length) != calculate_crc16_bytewise(buffers[i], length))
+			 {
+				fprintf(stderr, "CRC mismatch for %u byte payload\n", length);
+				return EXIT_FAILURE;
+			}
+		}
+	}
+	printf("calculate_crc16 matches the bytewise loop for 0-%d byte payloads\n\n", AN_MAXIMUM_PACKET_SIZE);
+
+	printf("%7s %14s %14s %8s\n", "length", "bytewise B/ns", "slice8 B/ns", "speedup");
+	for(length = 5; length <= AN_MAXIMUM_PACKET_SIZE; length += (length < 15) ? 5 : 20)
+	 {
+		bytewise = time_crc(calculate_crc16_bytewise, buffers, length, calls, &sink);
+		sliced = time_crc(calculate_crc16, buffers, length, calls, &sink);
+		printf("%7u %14.3f %14.3f %7.2fx\n", length, bytewise, sliced, sliced / bytewise);
+		bytewise_total += bytewise;
+		sliced_total += sliced;
+		sizes++;
+	}
+	printf("%7s %14.3f %14.3f %7.2fx\n", "mean", bytewise_total / sizes, sliced_total / sizes, sliced_total / bytewise_total);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,373 @@
+/****************************************************************/
+/*                                                              */
+/*                     Advanced Navigation                      */
+/*                  Packet Decoder Benchmark                    */
+/*         Copyright 2023, Advanced Navigation Pty Ltd          */
+/*                                                              */
+/****************************************************************/
+/*
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Replays synthetic ANPP streams, and optionally a recorded capture, through
+ * the decoder and the decode_*_packet() functions and reports throughput,
+ * per packet latency percentiles and allocations per packet.
+ *
+ * Usage: decode_bench [-s seconds] [-i iterations] [capture.anpp]
+ *
+ * Scenarios:
+ *   clean       system state packets read in full decoder sized chunks
+ *   bit_errors  Certus profile with one bit flipped in 1% of the bytes
+ *   fragmented  Certus profile read in random chunks of 1-64 bytes
+ *   certus      mixed packet ids matching a Certus streaming at 1 kHz
+ *   recorded    the capture given on the command line
+ *
+ * Each scenario is decoded with an_packet_decode(), an_packet_decode_view()
+ * and an_packet_decode_batch(). Allocations are counted through a packet
+ * pool installed behind an_packet_allocate().
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench_common.h"
+#include "an_packet_protocol.h"
+#include "ins_packets.h"
+
+#define BENCH_SECONDS_DEFAULT 60
+#define BENCH_ITERATIONS_DEFAULT 5
+#define BENCH_BIT_ERROR_PERCENT 1
+#define BENCH_FRAGMENT_MAXIMUM 64
+
+typedef enum
+{
+	decoder_packet,
+	decoder_view,
+	decoder_batch,
+	decoder_count
+} decoder_e;
+
+static const char* decoder_names[decoder_count] = {"an_packet_decode", "an_packet_decode_view", "an_packet_decode_batch"};
+
+typedef struct
+{
+	const char* name;
+	bench_stream_t stream;
+	int fragmented;
+} scenario_t;
+
+typedef struct
+{
+	uint32_t* samples;
+	size_t sample_count;
+	size_t sample_capacity;
+	uint64_t packets;
+	uint64_t decoded_structures;
+	uint64_t last_sample;
+} result_t;
+
+/*
+ * Decoded structures are written here so the compiler cannot drop the decode
+ */
+static union
+{
+	system_state_packet_t system_state;
+	unix_time_packet_t unix_time;
+	status_packet_t status;
+	velocity_standard_deviation_packet_t velocity_standard_deviation;
+	euler_orientation_standard_deviation_packet_t euler_orientation_standard_deviation;
+	raw_sensors_packet_t raw_sensors;
+	raw_gnss_packet_t raw_gnss;
+	satellites_packet_t satellites;
+	geodetic_position_packet_t geodetic_position;
+} decoded;
+
+/*
+ * Function to decode a packet view into its ins_packets.h structure
+ * Returns TRUE if the packet was a known type with the expected length
+ */
+static int decode_structure(const an_packet_view_t* an_packet_view)
+{
+	switch(an_packet_view->id)
+	 {
+		case packet_id_system_state: return decode_system_state_packet_view(&decoded.system_state, an_packet_view) == 0;
+		case packet_id_unix_time: return decode_unix_time_packet_view(&decoded.unix_time, an_packet_view) == 0;
+		case packet_id_status: return decode_status_packet_view(&decoded.status, an_packet_view) == 0;
+		case packet_id_velocity_standard_deviation: return decode_velocity_standard_deviation_packet_view(&decoded.velocity_standard_deviation, an_packet_view) == 0;
+		case packet_id_euler_orientation_standard_deviation: return decode_euler_orientation_standard_deviation_packet_view(&decoded.euler_orientation_standard_deviation, an_packet_view) == 0;
+		case packet_id_raw_sensors: return decode_raw_sensors_packet_view(&decoded.raw_sensors, an_packet_view) == 0;
+		case packet_id_raw_gnss: return decode_raw_gnss_packet_view(&decoded.raw_gnss, an_packet_view) == 0;
+		case packet_id_satellites: return decode_satellites_packet_view(&decoded.satellites, an_packet_view) == 0;
+		case packet_id_geodetic_position: return decode_geodetic_position_packet_view(&decoded.geodetic_position, an_packet_view) == 0;
+		default: return FALSE;
+	}
+}
+
+/*
+ * Function to decode an allocated packet through the an_packet_t decoders
+ */
+static int decode_packet_structure(an_packet_t* an_packet)
+{
+	switch(an_packet->id)
+	 {
+		case packet_id_system_state: return decode_system_state_packet(&decoded.system_state, an_packet) == 0;
+		case packet_id_unix_time: return decode_unix_time_packet(&decoded.unix_time, an_packet) == 0;
+		case packet_id_status: return decode_status_packet(&decoded.status, an_packet) == 0;
+		case packet_id_velocity_standard_deviation: return decode_velocity_standard_deviation_packet(&decoded.velocity_standard_deviation, an_packet) == 0;
+		case packet_id_euler_orientation_standard_deviation: return decode_euler_orientation_standard_deviation_packet(&decoded.euler_orientation_standard_deviation, an_packet) == 0;
+		case packet_id_raw_sensors: return decode_raw_sensors_packet(&decoded.raw_sensors, an_packet) == 0;
+		case packet_id_raw_gnss: return decode_raw_gnss_packet(&decoded.raw_gnss, an_packet) == 0;
+		case packet_id_satellites: return decode_satellites_packet(&decoded.satellites, an_packet) == 0;
+		case packet_id_geodetic_position: return decode_geodetic_position_packet(&decoded.geodetic_position, an_packet) == 0;
+		default: return FALSE;
+	}
+}
+
+/*
+ * Function to build the packets a Certus sends in one second at 1 kHz
+ * raw sensors at 1 kHz, system state at 200 Hz, velocity and orientation
+ * standard deviations at 50 Hz, status at 10 Hz and GNSS packets at 1 Hz
+ */
+static void build_certus_second(bench_stream_t* stream, uint64_t* state)
+{
+	int tick;
+	for(tick = 0; tick < 1000; tick++)
+	 {
+		bench_stream_append_packet(stream, packet_id_raw_sensors, 48, state);
+		if(tick % 5 == 0) bench_stream_append_packet(stream, packet_id_system_state, 100, state);
+		if(tick % 20 == 0)
+		 {
+			bench_stream_append_packet(stream, packet_id_velocity_standard_deviation, 12, state);
+			bench_stream_append_packet(stream, packet_id_euler_orientation_standard_deviation, 12, state);
+		}
+		if(tick % 100 == 0) bench_stream_append_packet(stream, packet_id_status, 4, state);
+		if(tick == 0)
+		 {
+			bench_stream_append_packet(stream, packet_id_unix_time, 8, state);
+			bench_stream_append_packet(stream, packet_id_raw_gnss, 74, state);
+			bench_stream_append_packet(stream, packet_id_satellites, 13, state);
+			bench_stream_append_packet(stream, packet_id_geodetic_position, 24, state);
+		}
+	}
+}
+
+static void build_scenarios(scenario_t* scenarios, int seconds, uint64_t* state)
+{
+	size_t i;
+	int second;
+
+	scenarios[0].name = "clean";
+	for(i = 0; i < (size_t) seconds * 1000; i++) bench_stream_append_packet(&scenarios[0].stream, packet_id_system_state, 100, state);
+
+	scenarios[1].name = "bit_errors";
+	for(second = 0; second < seconds; second++) build_certus_second(&scenarios[1].stream, state);
+	for(i = 0; i < scenarios[1].stream.length; i++)
+	 {
+		if(bench_random(state) % 100 < BENCH_BIT_ERROR_PERCENT) scenarios[1].stream.data[i] ^= (uint8_t) (1 << (bench_random(state) % 8));
+	}
+
+	scenarios[2].name = "fragmented";
+	scenarios[2].fragmented = TRUE;
+	for(second = 0; second < seconds; second++) build_certus_second(&scenarios[2].stream, state);
+
+	scenarios[3].name = "certus";
+	for(second = 0; second < seconds; second++) build_certus_second(&scenarios[3].stream, state);
+}
+
+static int load_capture(scenario_t* scenario, const char* path)
+{
+	FILE* file = fopen(path, "rb");
+	uint8_t chunk[65536];
+	size_t length;
+
+	if(file == NULL)
+	 {
+		perror(path);
+		return FALSE;
+	}
+	scenario->name = "recorded";
+	while((length = fread(chunk, 1, sizeof(chunk), file)) > 0)
+	 {
+		bench_stream_reserve(&scenario->stream, length);
+		memcpy(&scenario->stream.data[scenario->stream.length], chunk, length);
+		scenario->stream.length += length;
+	}
+	fclose(file);
+	return TRUE;
+}
+
+static void record_sample(result_t* result)
+{
+	uint64_t now = bench_now();
+	if(result->sample_count == result->sample_capacity)
+	 {
+		result->sample_capacity = result->sample_capacity ? result->sample_capacity * 2 : 65536;
+		result->samples = (uint32_t*) realloc(result->samples, result->sample_capacity * sizeof(uint32_t));
+		if(result->samples == NULL) abort();
+	}
+	result->samples[result->sample_count++] = (uint32_t) (now - result->last_sample);
+	result->last_sample = now;
+	result->packets++;
+}
+
+static void batch_callback(an_packet_view_t* an_packet_view, void* context)
+{
+	result_t* result = (result_t*) context;
+	result->decoded_structures += decode_structure(an_packet_view);
+	record_sample(result);
+}
+
+/*
+ * Function to replay a stream through one decoder
+ * Every read is sized by an_decoder_size(), or by a random 1-64 byte fragment
+ */
+static void replay(const scenario_t* scenario, decoder_e decoder, result_t* result, uint64_t* state)
+{
+	static an_decoder_t an_decoder;
+	an_packet_view_t an_packet_view;
+	an_packet_t* an_packet;
+	size_t offset = 0, length;
+
+	an_decoder_initialise(&an_decoder);
+	while(offset < scenario->stream.length)
+	 {
+		length = an_decoder_size(&an_decoder);
+		if(scenario->fragmented && length > 0)
+		 {
+			size_t fragment = 1 + (size_t) (bench_random(state) % BENCH_FRAGMENT_MAXIMUM);
+			if(fragment < length) length = fragment;
+		}
+		if(length > scenario->stream.length - offset) length = scenario->stream.length - offset;
+		if(length == 0)
+		 {
+			fprintf(stderr, "decoder buffer full with no packet to decode\n");
+			exit(EXIT_FAILURE);
+		}
+		memcpy(an_decoder_pointer(&an_decoder), &scenario->stream.data[offset], length);
+		an_decoder_increment(&an_decoder, length);
+		offset += length;
+
+		result->last_sample = bench_now();
+		switch(decoder)
+		 {
+			case decoder_packet:
+				while((an_packet = an_packet_decode(&an_decoder)) != NULL)
+				 {
+					result->decoded_structures += decode_packet_structure(an_packet);
+					an_packet_free(&an_packet);
+					record_sample(result);
+				}
+				break;
+			case decoder_view:
+				while(an_packet_decode_view(&an_decoder, &an_packet_view))
+				 {
+					result->decoded_structures += decode_structure(&an_packet_view);
+					record_sample(result);
+				}
+				break;
+			default:
+				while(an_packet_decode_batch(&an_decoder, batch_callback, result, 64) == 64);
+				break;
+		}
+	}
+}
+
+static void run_scenario(const scenario_t* scenario, decoder_e decoder, int iterations, an_packet_pool_t* an_packet_pool)
+{
+	an_packet_pool_statistics_t before, after;
+	result_t result;
+	uint64_t state = 0x9E3779B97F4A7C15ULL;
+	uint64_t start, elapsed;
+	double seconds;
+	int i;
+
+	memset(&result, 0, sizeof(result));
+	an_packet_pool_get_statistics(an_packet_pool, &before);
+	start = bench_now();
+	for(i = 0; i < iterations; i++) replay(scenario, decoder, &result, &state);
+	elapsed = bench_now() - start;
+	an_packet_pool_get_statistics(an_packet_pool, &after);
+
+	qsort(result.samples, result.sample_count, sizeof(uint32_t), bench_compare_uint32);
+	seconds = (double) elapsed / 1e9;
+	printf("%-11s %-23s %10.3f %9.1f %6u %6u %6u %7u %8u %7.3f %8.4f\n",
+		scenario->name,
+		decoder_names[decoder],
+		(double) result.packets / seconds / 1e6,
+		(double) scenario->stream.length * iterations / seconds / 1e6,
+		bench_percentile(result.samples, result.sample_count, 50.0),
+		bench_percentile(result.samples, result.sample_count, 90.0),
+		bench_percentile(result.samples, result.sample_count, 99.0),
+		bench_percentile(result.samples, result.sample_count, 99.9),
+		result.sample_count ? result.samples[result.sample_count - 1] : 0,
+		result.packets ? (double) (after.allocations - before.allocations) / (double) result.packets : 0.0,
+		result.packets ? (double) result.decoded_structures / (double) result.packets : 0.0);
+	free(result.samples);
+}
+
+int main(int argc, char* argv[])
+{
+	scenario_t scenarios[5];
+	int scenario_count = 4;
+	int seconds = BENCH_SECONDS_DEFAULT;
+	int iterations = BENCH_ITERATIONS_DEFAULT;
+	an_packet_pool_t* an_packet_pool;
+	uint64_t state = 0x2545F4914F6CDD1DULL;
+	int i, decoder;
+
+	memset(scenarios, 0, sizeof(scenarios));
+	for(i = 1; i < argc; i++)
+	 {
+		if(strcmp(argv[i], "-s") == 0 && i + 1 < argc) seconds = atoi(argv[++i]);
+		else if(strcmp(argv[i], "-i") == 0 && i + 1 < argc) iterations = atoi(argv[++i]);
+		else if(argv[i][0] == '-')
+		 {
+			fprintf(stderr, "usage: %s [-s seconds] [-i iterations] [capture.anpp]\n", argv[0]);
+			return EXIT_FAILURE;
+		}
+		else if(load_capture(&scenarios[4], argv[i])) scenario_count = 5;
+		else return EXIT_FAILURE;
+	}
+	if(seconds <= 0 || iterations <= 0)
+	 {
+		fprintf(stderr, "seconds and iterations must be positive\n");
+		return EXIT_FAILURE;
+	}
+
+	an_packet_pool = an_packet_pool_create(64);
+	if(an_packet_pool == NULL) return EXIT_FAILURE;
+	an_packet_pool_install(an_packet_pool);
+
+	build_scenarios(scenarios, seconds, &state);
+	printf("%d s of synthetic device output per scenario, %d iterations\n\n", seconds, iterations);
+	printf("%-11s %-23s %10s %9s %6s %6s %6s %7s %8s %7s %8s\n",
+		"scenario", "decoder", "Mpacket/s", "MB/s", "p50ns", "p90ns", "p99ns", "p99.9ns", "maxns", "alloc/p", "struct/p");
+	for(i = 0; i < scenario_count; i++)
+	 {
+		for(decoder = 0; decoder < decoder_count; decoder++) run_scenario(&scenarios[i], (decoder_e) decoder, iterations, an_packet_pool);
+		bench_stream_free(&scenarios[i].stream);
+	}
+
+	an_packet_pool_install(NULL);
+	an_packet_pool_destroy(&an_packet_pool);
+	return EXIT_SUCCESS;
+}
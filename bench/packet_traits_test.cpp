@@ -0,0 +1,291 @@
+/****************************************************************/
+/*                                                              */
+/*                     Advanced Navigation                      */
+/*                Packet Traits Round Trip Test                 */
+/*         Copyright 2023, Advanced Navigation Pty Ltd          */
+/*                                                              */
+/****************************************************************/
+/*
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+// Round trip check for every structure with packet_traits. Random payloads
+// are framed and decoded through adnav::decode<T>() and through the C
+// decode_*_packet() function, and the two results must match. Structures
+// with an encoder are then encoded through adnav::encode<T>() and the C
+// encode_*_packet() function, which must produce identical frames that
+// decode back to the same structure.
+
+#include <stdint.h>
+#include <string.h>
+#include <iostream>
+
+#include "adnav_packet_traits.h"
+
+namespace {
+
+constexpr int TRIALS = 32;
+
+uint64_t random_state = 0x9E3779B97F4A7C15ULL;
+
+uint8_t randomByte() {
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 7;
+    random_state ^= random_state << 17;
+    return static_cast<uint8_t>(random_state);
+}
+
+// Payload length to test, the wire size or a valid length for variable sized packets.
+template <typename T>
+size_t testLength() {return adnav::packet_traits<T>::wire_size;}
+// The passthrough decoder copies the data over the passthrough_data pointer
+// itself, so only a payload that fits in the pointer can be decoded safely.
+template <> size_t testLength<serial_port_passthrough_packet_t>() {return 1 + sizeof(uint8_t*);}
+template <> size_t testLength<subcomponent_information_packet_t>() {return 3 * 24;}
+template <> size_t testLength<raw_satellite_ephemeris_packet_t>() {return 132;}
+template <> size_t testLength<extended_satellites_packet_t>() {return 2 + 5 * 9;}
+template <> size_t testLength<packet_periods_packet_t>() {return 2 + 4 * 5;}
+
+// Payload bytes that select between layouts.
+template <typename T>
+void preparePayload(uint8_t*) {}
+template <> void preparePayload<raw_satellite_ephemeris_packet_t>(uint8_t* data) {data[4] = satellite_system_gps;}
+
+struct Frame {
+    uint8_t buffer[AN_PACKET_HEADER_SIZE + AN_MAXIMUM_PACKET_SIZE];
+    an_packet_view_t view;
+};
+
+template <typename T>
+void buildFrame(Frame& frame) {
+    size_t length = testLength<T>();
+    an_packet_view_initialise(&frame.view, frame.buffer, sizeof(frame.buffer), length, adnav::packet_traits<T>::id);
+    for(size_t i = 0; i < length; i++) frame.view.data[i] = randomByte();
+    preparePayload<T>(frame.view.data);
+    an_packet_view_encode(&frame.view);
+}
+
+bool fail(const char* name, const char* reason) {
+    std::cerr << name << ": " << reason << std::endl;
+    return false;
+}
+
+/*
+    Decode a frame through decode<T>() and the C decoder and compare the
+    results. Also checks that frames with the wrong id or length are rejected.
+*/
+template <typename T>
+bool decodeFrame(const char* name, int (*c_decode)(T*, an_packet_t*), const Frame& frame, T& packet) {
+    T reference;
+    memset(&packet, 0, sizeof(T));
+    memset(&reference, 0, sizeof(T));
+
+    if(!adnav::decode(frame.view, packet)) return fail(name, "decode<T> rejected a valid frame");
+    an_packet_t* an_packet = an_packet_allocate(frame.view.length, frame.view.id);
+    memcpy(an_packet->header, frame.view.header, AN_PACKET_HEADER_SIZE);
+    memcpy(an_packet->data, frame.view.data, frame.view.length);
+    int result = c_decode(&reference, an_packet);
+    an_packet_free(&an_packet);
+    if(result != 0) return fail(name, "C decoder rejected a valid frame");
+    if(memcmp(&packet, &reference, sizeof(T)) != 0) return fail(name, "decode<T> differs from the C decoder");
+
+    T rejected;
+    an_packet_view_t wrong = frame.view;
+    wrong.id++;
+    if(adnav::decode(wrong, rejected)) return fail(name, "decode<T> accepted the wrong packet id");
+    if(adnav::packet_traits<T>::wire_size != 0) {
+        wrong = frame.view;
+        wrong.length--;
+        if(adnav::decode(wrong, rejected)) return fail(name, "decode<T> accepted the wrong length");
+    }
+    return true;
+}
+
+/*
+    Encode a structure through encode<T>() and the C encoder, which must
+    produce identical frames matching packet_traits. Every payload byte must
+    be written by the encoder.
+*/
+template <typename T>
+bool encodeFrame(const char* name, an_packet_t* (*c_encode)(T*), const T& packet, Frame& frame) {
+    // Fill the buffer first so that bytes the encoder does not write show up as differences.
+    for(size_t i = 0; i < sizeof(frame.buffer); i++) frame.buffer[i] = randomByte();
+    int length = adnav::encode(packet, frame.buffer, sizeof(frame.buffer));
+    if(length < AN_PACKET_HEADER_SIZE) return fail(name, "encode<T> failed");
+    frame.view.id = frame.buffer[1];
+    frame.view.length = frame.buffer[2];
+    frame.view.header = frame.buffer;
+    frame.view.data = &frame.buffer[AN_PACKET_HEADER_SIZE];
+    frame.view.timestamp = 0;
+
+    an_packet_t* reference = c_encode(const_cast<T*>(&packet));
+    if(reference == nullptr) return fail(name, "C encoder failed");
+    bool identical = length == static_cast<int>(an_packet_size(reference)) &&
+        memcmp(frame.buffer, reference->header, AN_PACKET_HEADER_SIZE) == 0 &&
+        memcmp(frame.view.data, reference->data, reference->length) == 0;
+    an_packet_free(&reference);
+    if(!identical) return fail(name, "encode<T> differs from the C encoder");
+
+    if(frame.view.id != adnav::packet_traits<T>::id) return fail(name, "encoded id differs from packet_traits");
+    if(adnav::packet_traits<T>::wire_size != 0 && frame.view.length != adnav::packet_traits<T>::wire_size) {
+        return fail(name, "encoded length differs from packet_traits");
+    }
+    return true;
+}
+
+template <typename T>
+int checkDecode(const char* name, int (*c_decode)(T*, an_packet_t*)) {
+    Frame frame;
+    T packet;
+    for(int trial = 0; trial < TRIALS; trial++) {
+        buildFrame<T>(frame);
+        if(!decodeFrame(name, c_decode, frame, packet)) return 1;
+    }
+    return 0;
+}
+
+/*
+    Decode a random frame, encode it and decode it again. Encoders normalise
+    flags and clear reserved fields, so the first encode may differ from the
+    random frame. From then on the structure and its frame must be stable.
+*/
+template <typename T>
+int checkRoundTrip(const char* name, int (*c_decode)(T*, an_packet_t*), an_packet_t* (*c_encode)(T*)) {
+    Frame original, encoded, reencoded;
+    T packet, decoded, redecoded;
+    for(int trial = 0; trial < TRIALS; trial++) {
+        buildFrame<T>(original);
+        if(!decodeFrame(name, c_decode, original, packet)) return 1;
+        if(!encodeFrame(name, c_encode, packet, encoded)) return 1;
+        if(encoded.view.length != original.view.length) {
+            fail(name, "encoded length differs from the decoded frame");
+            return 1;
+        }
+        if(!decodeFrame(name, c_decode, encoded, decoded)) return 1;
+        if(!encodeFrame(name, c_encode, decoded, reencoded)) return 1;
+        if(memcmp(encoded.buffer, reencoded.buffer, AN_PACKET_HEADER_SIZE + encoded.view.length) != 0) {
+            fail(name, "encoding a round tripped structure changed its bytes");
+            return 1;
+        }
+        if(!decodeFrame(name, c_decode, reencoded, redecoded)) return 1;
+        if(memcmp(&decoded, &redecoded, sizeof(T)) != 0) {
+            fail(name, "structure changed over a round trip");
+            return 1;
+        }
+    }
+    return 0;
+}
+
+template <typename T>
+int checkEncode(const char* name, an_packet_t* (*c_encode)(T*)) {
+    Frame encoded;
+    T packet;
+    for(int trial = 0; trial < TRIALS; trial++) {
+        uint8_t* bytes = reinterpret_cast<uint8_t*>(&packet);
+        for(size_t i = 0; i < sizeof(T); i++) bytes[i] = randomByte();
+        if(!encodeFrame(name, c_encode, packet, encoded)) return 1;
+    }
+    return 0;
+}
+
+}// namespace
+
+#define CHECK_DECODE(type, decoder) failures += checkDecode<type>(#type, decoder); types++
+#define CHECK_ROUND_TRIP(type, decoder, encoder) failures += checkRoundTrip<type>(#type, decoder, encoder); types++
+#define CHECK_ENCODE(type, encoder) failures += checkEncode<type>(#type, encoder); types++
+
+int main() {
+    int failures = 0;
+    int types = 0;
+
+    CHECK_DECODE(acknowledge_packet_t, decode_acknowledge_packet);
+    CHECK_ROUND_TRIP(boot_mode_packet_t, decode_boot_mode_packet, encode_boot_mode_packet);
+    CHECK_DECODE(device_information_packet_t, decode_device_information_packet);
+    CHECK_DECODE(file_transfer_acknowledge_packet_t, decode_file_transfer_acknowledge_packet);
+    CHECK_DECODE(serial_port_passthrough_packet_t, decode_serial_port_passthrough_packet);
+    CHECK_ROUND_TRIP(ip_configuration_packet_t, decode_ip_configuration_packet, encode_ip_configuration_packet);
+    CHECK_DECODE(subcomponent_information_packet_t, decode_subcomponent_information_packet);
+    CHECK_DECODE(system_state_packet_t, decode_system_state_packet);
+    CHECK_DECODE(unix_time_packet_t, decode_unix_time_packet);
+    CHECK_DECODE(formatted_time_packet_t, decode_formatted_time_packet);
+    CHECK_DECODE(status_packet_t, decode_status_packet);
+    CHECK_DECODE(position_standard_deviation_packet_t, decode_position_standard_deviation_packet);
+    CHECK_DECODE(velocity_standard_deviation_packet_t, decode_velocity_standard_deviation_packet);
+    CHECK_DECODE(euler_orientation_standard_deviation_packet_t, decode_euler_orientation_standard_deviation_packet);
+    CHECK_DECODE(quaternion_orientation_standard_deviation_packet_t, decode_quaternion_orientation_standard_deviation_packet);
+    CHECK_DECODE(raw_sensors_packet_t, decode_raw_sensors_packet);
+    CHECK_ROUND_TRIP(raw_gnss_packet_t, decode_raw_gnss_packet, encode_raw_gnss_packet);
+    CHECK_DECODE(satellites_packet_t, decode_satellites_packet);
+    CHECK_DECODE(geodetic_position_packet_t, decode_geodetic_position_packet);
+    CHECK_DECODE(ecef_position_packet_t, decode_ecef_position_packet);
+    CHECK_DECODE(utm_position_packet_t, decode_utm_position_packet);
+    CHECK_DECODE(ned_velocity_packet_t, decode_ned_velocity_packet);
+    CHECK_DECODE(body_velocity_packet_t, decode_body_velocity_packet);
+    CHECK_DECODE(acceleration_packet_t, decode_acceleration_packet);
+    CHECK_DECODE(body_acceleration_packet_t, decode_body_acceleration_packet);
+    CHECK_DECODE(euler_orientation_packet_t, decode_euler_orientation_packet);
+    CHECK_DECODE(quaternion_orientation_packet_t, decode_quaternion_orientation_packet);
+    CHECK_DECODE(dcm_orientation_packet_t, decode_dcm_orientation_packet);
+    CHECK_DECODE(angular_velocity_packet_t, decode_angular_velocity_packet);
+    CHECK_DECODE(angular_acceleration_packet_t, decode_angular_acceleration_packet);
+    CHECK_ROUND_TRIP(external_position_velocity_packet_t, decode_external_position_velocity_packet, encode_external_position_velocity_packet);
+    CHECK_ROUND_TRIP(external_position_packet_t, decode_external_position_packet, encode_external_position_packet);
+    CHECK_ROUND_TRIP(external_velocity_packet_t, decode_external_velocity_packet, encode_external_velocity_packet);
+    CHECK_ROUND_TRIP(external_body_velocity_packet_t, decode_external_body_velocity_packet, encode_external_body_velocity_packet);
+    CHECK_ROUND_TRIP(external_heading_packet_t, decode_external_heading_packet, encode_external_heading_packet);
+    CHECK_DECODE(running_time_packet_t, decode_running_time_packet);
+    CHECK_DECODE(local_magnetics_packet_t, decode_local_magnetics_packet);
+    CHECK_DECODE(odometer_state_packet_t, decode_odometer_state_packet);
+    CHECK_ROUND_TRIP(external_time_packet_t, decode_external_time_packet, encode_external_time_packet);
+    CHECK_ROUND_TRIP(external_depth_packet_t, decode_external_depth_packet, encode_external_depth_packet);
+    CHECK_DECODE(geoid_height_packet_t, decode_geoid_height_packet);
+    CHECK_ROUND_TRIP(wind_packet_t, decode_wind_packet, encode_wind_packet);
+    CHECK_DECODE(heave_packet_t, decode_heave_packet);
+    CHECK_DECODE(raw_satellite_ephemeris_packet_t, decode_raw_satellite_ephemeris_packet);
+    CHECK_ROUND_TRIP(odometer_packet_t, decode_external_odometer_packet, encode_external_odometer_packet);
+    CHECK_ROUND_TRIP(external_air_data_packet_t, decode_external_air_data_packet, encode_external_air_data_packet);
+    CHECK_DECODE(gnss_receiver_information_packet_t, decode_gnss_information_packet);
+    CHECK_DECODE(raw_dvl_data_packet_t, decode_raw_dvl_data_packet);
+    CHECK_DECODE(north_seeking_status_packet_t, decode_north_seeking_status_packet);
+    CHECK_ROUND_TRIP(gimbal_state_packet_t, decode_gimbal_state_packet, encode_gimbal_state_packet);
+    CHECK_DECODE(automotive_packet_t, decode_automotive_packet);
+    CHECK_ROUND_TRIP(external_magnetometers_packet_t, decode_external_magnetometers_packet, encode_external_magnetometers_packet);
+    CHECK_DECODE(extended_satellites_packet_t, decode_extended_satellites_packet);
+    CHECK_ROUND_TRIP(packet_timer_period_packet_t, decode_packet_timer_period_packet, encode_packet_timer_period_packet);
+    CHECK_ROUND_TRIP(packet_periods_packet_t, decode_packet_periods_packet, encode_packet_periods_packet);
+    CHECK_ROUND_TRIP(baud_rates_packet_t, decode_baud_rates_packet, encode_baud_rates_packet);
+    CHECK_ROUND_TRIP(installation_alignment_packet_t, decode_installation_alignment_packet, encode_installation_alignment_packet);
+    CHECK_ROUND_TRIP(filter_options_packet_t, decode_filter_options_packet, encode_filter_options_packet);
+    CHECK_ROUND_TRIP(gpio_configuration_packet_t, decode_gpio_configuration_packet, encode_gpio_configuration_packet);
+    CHECK_ROUND_TRIP(odometer_configuration_packet_t, decode_odometer_configuration_packet, encode_odometer_configuration_packet);
+    CHECK_ROUND_TRIP(heave_offset_packet_t, decode_heave_offset_packet, encode_heave_offset_packet);
+    CHECK_ROUND_TRIP(gpio_output_configuration_packet_t, decode_gpio_output_configuration_packet, encode_gpio_output_configuration_packet);
+    CHECK_ROUND_TRIP(dual_antenna_configuration_packet_t, decode_dual_antenna_configuration_packet, encode_dual_antenna_configuration_packet);
+    CHECK_ROUND_TRIP(gnss_configuration_packet_t, decode_gnss_configuration_packet, encode_gnss_configuration_packet);
+    CHECK_ROUND_TRIP(user_data_packet_t, decode_user_data_packet, encode_user_data_packet);
+    CHECK_ROUND_TRIP(gpio_input_configuration_packet_t, decode_gpio_input_configuration_packet, encode_gpio_input_configuration_packet);
+    CHECK_ROUND_TRIP(ip_dataports_configuration_packet_t, decode_ip_dataports_configuration_packet, encode_ip_dataports_configuration_packet);
+    CHECK_ROUND_TRIP(can_configuration_packet_t, decode_can_configuration_packet, encode_can_configuration_packet);
+    CHECK_ENCODE(zero_angular_velocity_packet_t, encode_zero_angular_velocity_packet);
+    CHECK_ENCODE(zero_alignment_packet_t, encode_zero_alignment_packet);
+
+    std::cout << types << " packet types checked, " << failures << " failed" << std::endl;
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,217 @@
+/****************************************************************/
+/*                                                              */
+/*                     Advanced Navigation                      */
+/*                 Resynchronisation Benchmark                  */
+/*         Copyright 2023, Advanced Navigation Pty Ltd          */
+/*                                                              */
+/****************************************************************/
+/*
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+
+/*
+ * Measures how fast the decoder recovers from corrupted input. Streams with
+ * random garbage between frames are decoded by the original byte at a time
+ * scanner with the bytewise CRC, and by an_packet_decode(). Both must find
+ * the same packets and count the same errors. Throughput is reported in MB/s
+ * of input consumed.
+ *
+ * Usage: resync_bench [-m megabytes per scenario]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench_common.h"
+#include "an_packet_protocol.h"
+
+#define BENCH_MEGABYTES_DEFAULT 32
+
+/*
+ * Decoder as it was before the header search, kept as the baseline
+ */
+static uint16_t reference_crc16(const uint8_t* data, uint16_t length)
+{
+	uint16_t crc = 0xFFFF, i;
+	for(i = 0; i < length; i++)
+	 {
+		crc = (uint16_t) ((crc << 8) ^ crc16_table[(crc >> 8) ^ data[i]]);
+	}
+	return crc;
+}
+
+static uint8_t reference_header_lrc(const uint8_t* data)
+{
+	return ((data[0] + data[1] + data[2] + data[3]) ^ 0xFF) + 1;
+}
+
+static an_packet_t* reference_packet_decode(an_decoder_t* an_decoder)
+{
+	uint16_t decode_iterator = 0;
+	an_packet_t* an_packet = NULL;
+	uint8_t header_lrc, id, length;
+	uint16_t crc;
+
+	while(decode_iterator + AN_PACKET_HEADER_SIZE <= an_decoder->buffer_length)
+	 {
+		header_lrc = an_decoder->buffer[decode_iterator++];
+		if(header_lrc == reference_header_lrc(&an_decoder->buffer[decode_iterator]))
+		 {
+			id = an_decoder->buffer[decode_iterator++];
+			length = an_decoder->buffer[decode_iterator++];
+			crc = an_decoder->buffer[decode_iterator++];
+			crc |= an_decoder->buffer[decode_iterator++] << 8;
+
+			if(decode_iterator + length > an_decoder->buffer_length)
+			 {
+				decode_iterator -= AN_PACKET_HEADER_SIZE;
+				break;
+			}
+
+			if(crc == reference_crc16(&an_decoder->buffer[decode_iterator], length))
+			 {
+				an_packet = an_packet_allocate(length, id);
+				if(an_packet != NULL)
+				 {
+					memcpy(an_packet->header, &an_decoder->buffer[decode_iterator - AN_PACKET_HEADER_SIZE], AN_PACKET_HEADER_SIZE * sizeof(uint8_t));
+					memcpy(an_packet->data, &an_decoder->buffer[decode_iterator], length * sizeof(uint8_t));
+				}
+				decode_iterator += length;
+				an_decoder->packets_decoded++;
+				an_decoder->bytes_decoded += length + AN_PACKET_HEADER_SIZE;
+				break;
+			}
+			else
+			 {
+				decode_iterator -= (AN_PACKET_HEADER_SIZE - 1);
+				an_decoder->crc_errors++;
+				an_decoder->bytes_discarded++;
+			}
+		}
+		else
+		 {
+			an_decoder->lrc_errors++;
+			an_decoder->bytes_discarded++;
+		}
+	}
+	if(decode_iterator < an_decoder->buffer_length)
+	 {
+		if(decode_iterator > 0)
+		 {
+			memmove(&an_decoder->buffer[0], &an_decoder->buffer[decode_iterator], (an_decoder->buffer_length - decode_iterator) * sizeof(uint8_t));
+			an_decoder->buffer_length -= decode_iterator;
+		}
+	}
+	else an_decoder->buffer_length = 0;
+
+	return an_packet;
+}
+
+typedef an_packet_t* (*decode_function_t)(an_decoder_t* an_decoder);
+
+/*
+ * Function to build a stream where every frame is preceded by up to
+ * maximum_garbage random bytes, starting part way through a frame as if
+ * attached mid-stream
+ */
+static void build_stream(bench_stream_t* stream, size_t megabytes, size_t maximum_garbage, uint64_t* state)
+{
+	static const uint8_t lengths[] = {100, 48, 74, 13, 12, 8, 4};
+	bench_stream_t first = {NULL, 0, 0};
+
+	bench_stream_append_packet(&first, 20, 100, state);
+	bench_stream_reserve(stream, first.length);
+	memcpy(stream->data, &first.data[37], first.length - 37);
+	stream->length = first.length - 37;
+	bench_stream_free(&first);
+
+	while(stream->length < megabytes * 1000000)
+	 {
+		if(maximum_garbage > 0) bench_stream_append_garbage(stream, (size_t) (bench_random(state) % (maximum_garbage + 1)), state);
+		bench_stream_append_packet(stream, (uint8_t) (20 + bench_random(state) % 20), lengths[bench_random(state) % sizeof(lengths)], state);
+	}
+}
+
+/*
+ * Function to decode a stream and return the throughput in MB/s
+ */
+static double decode_stream(const bench_stream_t* stream, decode_function_t decode_function, an_decoder_t* an_decoder)
+{
+	an_packet_t* an_packet;
+	size_t offset = 0, length;
+	uint64_t start, elapsed;
+
+	an_decoder_initialise(an_decoder);
+	start = bench_now();
+	while(offset < stream->length)
+	 {
+		length = an_decoder_size(an_decoder);
+		if(length > stream->length - offset) length = stream->length - offset;
+		memcpy(an_decoder_pointer(an_decoder), &stream->data[offset], length);
+		an_decoder_increment(an_decoder, length);
+		offset += length;
+		while((an_packet = decode_function(an_decoder)) != NULL) an_packet_free(&an_packet);
+	}
+	elapsed = bench_now() - start;
+	return (double) stream->length / ((double) elapsed / 1e9) / 1e6;
+}
+
+int main(int argc, char* argv[])
+{
+	static const size_t garbage[] = {0, 16, 64, 256, 1024};
+	static an_decoder_t reference, current;
+	bench_stream_t stream;
+	uint64_t state = 0x9E3779B97F4A7C15ULL;
+	size_t megabytes = BENCH_MEGABYTES_DEFAULT;
+	double before, after;
+	size_t i;
+
+	if(argc == 3 && strcmp(argv[1], "-m") == 0) megabytes = (size_t) atoi(argv[2]);
+	if((argc != 1 && argc != 3) || megabytes == 0)
+	 {
+		fprintf(stderr, "usage: %s [-m megabytes per scenario]\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	printf("%zu MB per scenario\n\n", megabytes);
+	printf("%12s %9s %10s %10s %11s %11s %8s\n", "max garbage", "packets", "crc errs", "discarded", "before MB/s", "after MB/s", "speedup");
+	for(i = 0; i < sizeof(garbage) / sizeof(garbage[0]); i++)
+	 {
+		memset(&stream, 0, sizeof(stream));
+		build_stream(&stream, megabytes, garbage[i], &state);
+		before = decode_stream(&stream, reference_packet_decode, &reference);
+		after = decode_stream(&stream, an_packet_decode, &current);
+		bench_stream_free(&stream);
+
+		if(reference.packets_decoded != current.packets_decoded || reference.crc_errors != current.crc_errors ||
+			reference.lrc_errors != current.lrc_errors || reference.bytes_discarded != current.bytes_discarded)
+		 {
+			fprintf(stderr, "decoder counters differ from the reference with up to %zu garbage bytes per frame\n", garbage[i]);
+			return EXIT_FAILURE;
+		}
+		printf("%12zu %9llu %10llu %10llu %11.1f %11.1f %7.2fx\n", garbage[i],
+			(unsigned long long) current.packets_decoded, (unsigned long long) current.crc_errors,
+			(unsigned long long) current.bytes_discarded, before, after, after / before);
+	}
+
+	return EXIT_SUCCESS;
+}
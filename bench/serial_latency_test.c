@@ -0,0 +1,192 @@
+/****************************************************************/
+/*                                                              */
+/*                     Advanced Navigation                      */
+/*                  Serial Receive Latency Test                 */
+/*         Copyright 2023, Advanced Navigation Pty Ltd          */
+/*                                                              */
+/****************************************************************/
+/*
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Measures the time from a packet being written to a serial port until
+ * com_read() has returned all of it, for a port opened with
+ * com_open_path_low_latency(). A pseudo terminal stands in for the device
+ * and a writer thread sends a raw sensors packet every millisecond, stamped
+ * with the time it was written. The reader waits in poll() and decodes what
+ * com_read() returns, as the reactor does. The test fails if a packet is
+ * lost or the 99th percentile latency is 1 ms or more.
+ *
+ * Usage: serial_latency_test [-n packets]
+ */
+
+#include <errno.h>
+#include <poll.h>
+#include <pthread.h>
+#include <pty.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "bench_common.h"
+#include "an_packet_protocol.h"
+#include "ins_packets.h"
+#include "rs232.h"
+
+#define TEST_PACKETS_DEFAULT 2000
+#define TEST_PERIOD_NS 1000000ULL
+#define TEST_LIMIT_NS 1000000U
+
+typedef struct
+{
+	int fd;
+	int packets;
+} writer_t;
+
+/*
+ * Function to write one stamped raw sensors packet per period to the pty master
+ */
+static void* writer_thread(void* context)
+{
+	writer_t* writer = (writer_t*) context;
+	uint8_t buffer[AN_PACKET_HEADER_SIZE + 48];
+	an_packet_view_t an_packet_view;
+	struct timespec next;
+	uint64_t stamp;
+	size_t offset;
+	ssize_t written;
+	int i;
+
+	clock_gettime(CLOCK_MONOTONIC, &next);
+	for(i = 0; i < writer->packets; i++)
+	 {
+		next.tv_nsec += TEST_PERIOD_NS;
+		if(next.tv_nsec >= 1000000000L)
+		 {
+			next.tv_nsec -= 1000000000L;
+			next.tv_sec++;
+		}
+		clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+
+		an_packet_view_initialise(&an_packet_view, buffer, sizeof(buffer), 48, packet_id_raw_sensors);
+		memset(an_packet_view.data, 0, 48);
+		stamp = bench_now();
+		memcpy(an_packet_view.data, &stamp, sizeof(stamp));
+		an_packet_view_encode(&an_packet_view);
+		for(offset = 0; offset < sizeof(buffer); offset += (size_t) written)
+		 {
+			written = write(writer->fd, &buffer[offset], sizeof(buffer) - offset);
+			if(written <= 0) return NULL;
+		}
+	}
+	return NULL;
+}
+
+int main(int argc, char* argv[])
+{
+	COMLatency latency;
+	com_handle_t* com;
+	an_decoder_t an_decoder;
+	an_packet_view_t an_packet_view;
+	struct pollfd descriptor;
+	writer_t writer;
+	pthread_t thread;
+	uint32_t* samples;
+	uint64_t stamp, now;
+	char path[64];
+	int master, slave, received = 0, count = TEST_PACKETS_DEFAULT, length, result;
+
+	if(argc == 3 && strcmp(argv[1], "-n") == 0) count = atoi(argv[2]);
+	if((argc != 1 && argc != 3) || count <= 0)
+	 {
+		fprintf(stderr, "usage: %s [-n packets]\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	if(openpty(&master, &slave, path, NULL, NULL) < 0)
+	 {
+		perror("openpty");
+		return EXIT_FAILURE;
+	}
+	com = com_open_path_low_latency(path, 115200, &latency);
+	if(com == NULL)
+	 {
+		fprintf(stderr, "Unable to open %s\n", path);
+		return EXIT_FAILURE;
+	}
+	printf("%s: low_latency %d latency_timer %d\n", path, latency.low_latency, latency.latency_timer);
+
+	samples = (uint32_t*) malloc(sizeof(uint32_t) * (size_t) count);
+	if(samples == NULL) abort();
+	an_decoder_initialise(&an_decoder);
+
+	writer.fd = master;
+	writer.packets = count;
+	pthread_create(&thread, NULL, writer_thread, &writer);
+
+	descriptor.fd = com_get_fd(com);
+	descriptor.events = POLLIN;
+	while(received < count)
+	 {
+		descriptor.revents = 0;
+		result = poll(&descriptor, 1, 1000);
+		if(result < 0 && errno == EINTR) continue;
+		if(result <= 0) break;
+
+		length = com_read(com, an_decoder_pointer(&an_decoder), an_decoder_size(&an_decoder));
+		now = bench_now();
+		if(length <= 0) continue;
+		an_decoder_increment(&an_decoder, length);
+		while(an_packet_decode_view(&an_decoder, &an_packet_view))
+		 {
+			if(an_packet_view.id != packet_id_raw_sensors || received >= count) continue;
+			memcpy(&stamp, an_packet_view.data, sizeof(stamp));
+			samples[received++] = (uint32_t) (now - stamp);
+		}
+	}
+	pthread_join(thread, NULL);
+
+	qsort(samples, (size_t) received, sizeof(uint32_t), bench_compare_uint32);
+	printf("%d/%d packets, latency us p50 %.1f p90 %.1f p99 %.1f max %.1f\n", received, count,
+		bench_percentile(samples, (size_t) received, 50.0) / 1000.0,
+		bench_percentile(samples, (size_t) received, 90.0) / 1000.0,
+		bench_percentile(samples, (size_t) received, 99.0) / 1000.0,
+		bench_percentile(samples, (size_t) received, 100.0) / 1000.0);
+
+	result = EXIT_SUCCESS;
+	if(received != count)
+	 {
+		fprintf(stderr, "%d packets lost\n", count - received);
+		result = EXIT_FAILURE;
+	}
+	else if(bench_percentile(samples, (size_t) received, 99.0) >= TEST_LIMIT_NS)
+	 {
+		fprintf(stderr, "99th percentile latency is not under 1 ms\n");
+		result = EXIT_FAILURE;
+	}
+
+	free(samples);
+	com_close(com);
+	close(slave);
+	close(master);
+	return result;
+}
@@ -0,0 +1,191 @@
+/****************************************************************/
+/*                                                              */
+/*                     Advanced Navigation                      */
+/*                  TCP Receive Path Benchmark                  */
+/*         Copyright 2023, Advanced Navigation Pty Ltd          */
+/*                                                              */
+/****************************************************************/
+/*
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+// CPU cost of Communicator::readBatch() over loopback TCP, with the POSIX
+// recvmsg path and with the io_uring receive path. A server thread streams
+// raw satellite data and raw sensors packets, and the receiving thread's CPU
+// time is reported per MB decoded.
+//
+//   uring_bench [-m megabytes] [-i iterations]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <iostream>
+#include <thread>
+
+#include "adnav_comms.h"
+#include "bench_common.h"
+#include "ins_packets.h"
+
+namespace {
+
+constexpr uint8_t RAW_SATELLITE_DATA_LENGTH = 16 + 8 * 26;
+constexpr uint8_t RAW_SENSORS_LENGTH = 48;
+
+struct Result {
+    double cpu_ms_per_mb;
+    double megabytes_per_second;
+    uint64_t packets;
+};
+
+uint64_t threadCpuNow() {
+    struct timespec now;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+    return (uint64_t) now.tv_sec * 1000000000ULL + (uint64_t) now.tv_nsec;
+}
+
+// Stream the block repeatedly to the first client that connects, then hang up.
+void serve(int listener, const bench_stream_t* block, int repeats) {
+    int client = accept(listener, NULL, NULL);
+    if(client < 0) return;
+    for(int i = 0; i < repeats; i++) {
+        size_t offset = 0;
+        while(offset < block->length) {
+            ssize_t sent = send(client, &block->data[offset], block->length - offset, MSG_NOSIGNAL);
+            if(sent <= 0) {
+                ::close(client);
+                return;
+            }
+            offset += (size_t) sent;
+        }
+    }
+    ::close(client);
+}
+
+bool run(bool io_uring, const bench_stream_t* block, int repeats, uint64_t expected_packets, Result* result) {
+    int listener = socket(AF_INET, SOCK_STREAM, 0);
+    struct sockaddr_in address;
+    socklen_t address_length = sizeof(address);
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if(listener < 0 || bind(listener, (struct sockaddr*) &address, sizeof(address)) < 0 || listen(listener, 1) < 0 ||
+        getsockname(listener, (struct sockaddr*) &address, &address_length) < 0) {
+        perror("listener");
+        exit(EXIT_FAILURE);
+    }
+    std::thread server(serve, listener, block, repeats);
+
+    adnav::adnav_connections_data_t ops;
+    ops.method = adnav::CONNECTION_TCP_CLIENT;
+    ops.ip_address = "127.0.0.1";
+    ops.port = ntohs(address.sin_port);
+    ops.baud_rate = 0;
+    ops.index = 0;
+
+    bool available = true;
+    uint64_t packets = 0;
+    uint64_t received = 0;
+    uint64_t wall_start = 0, cpu_start = 0;
+    {
+        // Keep the connection banners out of the results.
+        std::cout.setstate(std::ios_base::failbit);
+        adnav::Communicator communicator(ops);
+        communicator.open();
+        std::cout.clear();
+        if(io_uring && !communicator.useIoUring()) available = false;
+
+        an_decoder_t an_decoder;
+        an_decoder_initialise(&an_decoder);
+        wall_start = bench_now();
+        cpu_start = threadCpuNow();
+        while(available) {
+            int count = communicator.readBatch(&an_decoder, [&packets](const an_packet_view_t&) {packets++;});
+            if(count <= 0) break;
+            received += (uint64_t) count;
+        }
+        communicator.close();
+    }
+    uint64_t cpu = threadCpuNow() - cpu_start;
+    uint64_t wall = bench_now() - wall_start;
+
+    server.join();
+    ::close(listener);
+    if(!available) return false;
+
+    if(packets != expected_packets) {
+        fprintf(stderr, "%s: decoded %llu packets, expected %llu\n", io_uring ? "io_uring" : "posix",
+            (unsigned long long) packets, (unsigned long long) expected_packets);
+        exit(EXIT_FAILURE);
+    }
+    double megabytes = (double) received / 1e6;
+    result->cpu_ms_per_mb = ((double) cpu / 1e6) / megabytes;
+    result->megabytes_per_second = megabytes / ((double) wall / 1e9);
+    result->packets = packets;
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    int megabytes = 256;
+    int iterations = 5;
+    int option;
+    while((option = getopt(argc, argv, "m:i:")) != -1) {
+        switch(option) {
+            case 'm': megabytes = atoi(optarg); break;
+            case 'i': iterations = atoi(optarg); break;
+            default:
+                fprintf(stderr, "usage: %s [-m megabytes] [-i iterations]\n", argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+    if(megabytes < 1) megabytes = 1;
+    if(iterations < 1) iterations = 1;
+
+    // 1 MB block of alternating raw satellite data and raw sensors packets.
+    bench_stream_t block;
+    uint64_t state = 0x2545F4914F6CDD1DULL;
+    uint64_t block_packets = 0;
+    memset(&block, 0, sizeof(block));
+    while(block.length < 1000000) {
+        bench_stream_append_packet(&block, packet_id_raw_satellite_data, RAW_SATELLITE_DATA_LENGTH, &state);
+        bench_stream_append_packet(&block, packet_id_raw_sensors, RAW_SENSORS_LENGTH, &state);
+        block_packets += 2;
+    }
+    uint64_t expected_packets = block_packets * (uint64_t) megabytes;
+
+    printf("%-10s %12s %12s %12s\n", "path", "cpu ms/MB", "MB/s", "packets");
+    for(int i = 0; i < iterations; i++) {
+        for(int io_uring = 0; io_uring < 2; io_uring++) {
+            Result result;
+            if(!run(io_uring != 0, &block, megabytes, expected_packets, &result)) {
+                printf("%-10s %12s\n", "io_uring", "unavailable");
+                continue;
+            }
+            printf("%-10s %12.3f %12.1f %12llu\n", io_uring ? "io_uring" : "posix", result.cpu_ms_per_mb,
+                result.megabytes_per_second, (unsigned long long) result.packets);
+        }
+    }
+
+    bench_stream_free(&block);
+    return EXIT_SUCCESS;
+}
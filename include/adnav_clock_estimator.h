@@ -0,0 +1,149 @@
+/****************************************************************/
+/*                                                              */
+/*                     Advanced Navigation                      */
+/*                   Clock Offset Estimator                     */
+/*         Copyright 2023, Advanced Navigation Pty Ltd          */
+/*                                                              */
+/****************************************************************/
+/*
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef ADNAV_CLOCK_ESTIMATOR_H_
+#define ADNAV_CLOCK_ESTIMATOR_H_
+
+#include <stdint.h>
+
+#include "an_packet_protocol.h"
+#include "ins_packets.h"
+
+namespace adnav {
+
+typedef struct {
+    // Host time minus device time at the most recent device time, in ns.
+    int64_t offset;
+    // Rate of change of the offset, in parts per million.
+    double drift_ppm;
+    // RMS deviation of the filtered samples from the fitted line, in ns.
+    double residual_rms;
+    // Transport delay of the last sample above the minimum of its window, in ns.
+    int64_t excess_delay;
+    // Number of time samples and filter windows accepted.
+    uint64_t samples;
+    uint64_t windows;
+    // True once enough windows have been seen to estimate drift.
+    bool locked;
+}clock_estimate_t;
+
+/**
+ * @brief Streaming estimate of the offset and drift between a device's GNSS
+ * disciplined clock and the host clock.
+ * Each update pairs a device time from a system state or unix time packet
+ * with the host receive time of that packet. Transport delays only ever add
+ * to the apparent offset, so the sample with the smallest offset in each
+ * window is kept and the window minima are fitted with an exponentially
+ * weighted linear regression. Memory and time per update are constant.
+ *
+ * The one way transport delay cannot be separated from the clock offset, so
+ * the minimum delay of the link is included in offset and in the host times
+ * returned by deviceToHost().
+*/
+class ClockEstimator {
+    public:
+        /**
+         * @brief Constructor
+         * @param window_size Samples per minimum delay window, e.g. the system state rate.
+         * @param forgetting_factor Weight kept by each older window in the regression, (0, 1].
+        */
+        explicit ClockEstimator(uint32_t window_size = 50, double forgetting_factor = 0.99);
+
+        /**
+         * @brief Add a device and host time pair.
+         * @param device_time Device time in ns since the Unix epoch.
+         * @param host_time Host receive time in ns since the Unix epoch.
+        */
+        void update(uint64_t device_time, uint64_t host_time);
+
+        /**
+         * @brief Add the time carried by a system state or unix time packet.
+         * @param an_packet Decoded packet carrying its host receive timestamp.
+         * @return true if the packet carried a device time and was used.
+        */
+        bool update(const an_packet_view_t& an_packet);
+
+        /**
+         * @brief Map a device time onto the host clock.
+        */
+        uint64_t deviceToHost(uint64_t device_time) const;
+
+        /**
+         * @brief Map a host time, such as a packet receive timestamp, onto the device clock.
+        */
+        uint64_t hostToDevice(uint64_t host_time) const;
+
+        /**
+         * @brief Corrected host timestamp for a packet.
+         * Packets that carry a device time are mapped through deviceToHost(),
+         * which removes the queueing jitter of the link. Other packets keep
+         * their receive timestamp. Until the first sample both are unchanged.
+        */
+        uint64_t correct(const an_packet_view_t& an_packet) const;
+
+        clock_estimate_t estimate() const;
+
+        void reset();
+
+        /**
+         * @brief Extract the device time from a system state or unix time packet.
+         *
+         * @param device_time Device time in nanoseconds since the Unix epoch.
+         * @return false for other packets, or before the device has a time source.
+        */
+        static bool deviceTime(const an_packet_view_t& an_packet, uint64_t* device_time);
+
+    private:
+        // Offset of the fitted line at device time x seconds from the newest window.
+        double fittedOffset(double x) const;
+
+        uint32_t window_size_;
+        double forgetting_factor_;
+
+        // Reference offset subtracted from samples to keep the regression well conditioned.
+        int64_t reference_offset_;
+        // Device time of the newest window minimum, the origin of the regression.
+        uint64_t origin_;
+
+        // Current window.
+        uint32_t window_count_;
+        int64_t window_minimum_;
+        uint64_t window_device_time_;
+
+        // Exponentially weighted sums of x, y = offset - reference_offset_.
+        double s0_, sx_, sy_, sxx_, sxy_;
+        double residual_ms_;
+
+        int64_t last_excess_delay_;
+        uint64_t samples_;
+        uint64_t windows_;
+};
+
+}// namespace adnav
+
+#endif // ADNAV_CLOCK_ESTIMATOR_H_
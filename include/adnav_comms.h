@@ -31,6 +31,11 @@
 
 #include "rs232.h"
 #include "adnav_utils.h"
+#include "adnav_reactor.h"
+#include "adnav_reconnector.h"
+#include "adnav_serial_reconnector.h"
+#include "adnav_uring.h"
+#include "an_packet_protocol.h"
 #include <stdio.h>
 #include <string>
 #include <cstring>
@@ -39,6 +44,11 @@
 #include <sstream>
 #include <thread>
 #include <chrono>
+#include <functional>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <algorithm>
 
 #include <signal.h>
 
@@ -58,19 +68,29 @@
     #include <unistd.h>
     #include <errno.h>
     #include <ifaddrs.h>
+    #include <sys/uio.h>
+    #include <time.h>
+    #include <poll.h>
+    #include <limits.h>
 #endif
 
 namespace adnav {
 
 constexpr int MAX_CONNECTION_TRYS = 3;
 constexpr int CONNECTION_RETRY_TIMEOUT = 2;
+constexpr int UDP_BATCH_SIZE = 16;
+constexpr int UDP_DATAGRAM_BUFFER_SIZE = 2048;
+constexpr int WRITE_TIMEOUT_MS = 1000;
+// Further write timeouts allowed to finish a buffer that is partly written.
+constexpr int MAX_WRITE_STALLS = 3;
 
 typedef enum {
     CONNECTION_NOT_OPEN = -1,
     CONNECTION_SERIAL,
     CONNECTION_TCP_CLIENT,
     CONNECTION_TCP_SERVER,
-    CONNECTION_UDP_CLIENT
+    CONNECTION_UDP_CLIENT,
+    CONNECTION_FILE_REPLAY
 }adnav_connection_e;
 
 typedef struct {
@@ -80,6 +100,19 @@ typedef struct {
 	int port;
 	int baud_rate;
     int index;
+	// CONNECTION_FILE_REPLAY: raw ANPP capture to play back, playback speed
+	// relative to the capture (0 for as fast as possible) and whether to mmap it.
+	std::string file_path;
+	double replay_speed = 0;
+	bool replay_mmap = false;
+	// CONNECTION_SERIAL: open with com_open_path_low_latency() to receive bytes as they arrive.
+	bool serial_low_latency = false;
+	// CONNECTION_SERIAL: reopen the port with a SerialReconnector whenever the device is
+	// removed (Linux only). The port need not be present when open() is called.
+	bool serial_reconnect = false;
+	// CONNECTION_TCP_CLIENT: keep the connection up with a TcpReconnector (Linux only).
+	// open() returns without waiting for the device, see Communicator::onLinkStateChange().
+	bool tcp_reconnect = false;
 }adnav_connections_data_t;
 
 class Communicator{
@@ -99,17 +132,131 @@ class Communicator{
          * @param ops Options data structure. see adnav_connections_data_t 
         */
         Communicator(const adnav_connections_data_t& ops) {initComms(ops);}
-        ~Communicator() {close();}
+        ~Communicator() {if(isOpen_) close();}
         bool isOpen() {return isOpen_;}
 
         void initComms(const adnav_connections_data_t& ops);
         void open();
         void close();
 
+        // File replays return 0 at the end of the capture and discard writes.
         int read(void* buf, size_t len);
         int write(void* buf, size_t len);
         int getMethod() {return connection_ops_.method;}
 
+#if defined(__linux__)
+        /**
+         * @brief Read with the host receive time of the data.
+         * Sockets report the time the kernel received the data (SO_TIMESTAMPNS),
+         * serial ports the time the read returned.
+         *
+         * @param timestamp Receive time in nanoseconds since the Unix epoch.
+         * @return Number of bytes read, as read().
+        */
+        int readTimestamped(void* buf, size_t len, uint64_t* timestamp);
+
+        /**
+         * @brief Wait until at least min_bytes have been read or the timeout expires.
+         * Everything already available is returned, up to len, so asking for
+         * AN_PACKET_HEADER_SIZE bytes wakes the caller once per packet header
+         * rather than once per byte. Waits use ppoll(), so any descriptor number
+         * works. UDP connections return a single datagram.
+         *
+         * @param timeout_ns Longest wait in nanoseconds, negative to wait indefinitely.
+         * @return Number of bytes read, fewer than min_bytes on timeout, -1 on error.
+        */
+        int readAtLeast(void* buf, size_t len, size_t min_bytes, int64_t timeout_ns);
+
+        /**
+         * @brief Read and decode in batches.
+         * UDP connections receive up to max_datagrams datagrams with a single
+         * recvmmsg call, other methods perform a single read(). The received
+         * bytes are appended to the decoder and every decoded packet is passed
+         * to the handler before returning. Packets carry the receive time of
+         * their first byte, see readTimestamped().
+         *
+         * @param an_decoder Decoder to feed.
+         * @param on_packet Handler for each decoded packet view.
+         * @param max_datagrams Maximum datagrams per call, up to UDP_BATCH_SIZE.
+         * @return Number of bytes received, -1 on error.
+        */
+        int readBatch(an_decoder_t* an_decoder, const std::function<void(const an_packet_view_t&)>& on_packet,
+            int max_datagrams = UDP_BATCH_SIZE);
+
+        /**
+         * @brief Receive TCP data in readBatch() through io_uring.
+         * A multishot receive is kept posted so data is collected without a
+         * system call per read. Receive timestamps are taken when the data is
+         * collected rather than from the kernel. As the kernel drains the
+         * socket itself, this cannot be combined with attach().
+         *
+         * @return false, keeping the POSIX path, if the connection is not TCP
+         * or io_uring or the features it needs are unavailable.
+        */
+        bool useIoUring();
+
+        /**
+         * @brief Write several buffers at once.
+         * UDP connections send each buffer as its own datagram with a single
+         * sendmmsg call. Serial and TCP connections gather them with writev,
+         * resuming after short writes and waiting for the descriptor to become
+         * writable, for up to WRITE_TIMEOUT_MS at a time, when it would block.
+         * A timeout only ends the write between buffers: a buffer that has
+         * been partly written is given up to MAX_WRITE_STALLS further
+         * timeouts to finish, so a stalled device is not left with a
+         * truncated packet.
+         *
+         * @return Number of bytes sent, which is less than the total when the
+         * write timed out or failed part way, -1 on error.
+        */
+        int writeBatch(const struct iovec* buffers, int count);
+
+        // Writes that had to be resumed, and waits for a full descriptor to drain.
+        uint64_t partialWrites() {return partial_writes_.load(std::memory_order_relaxed);}
+        uint64_t writeStalls() {return write_stalls_.load(std::memory_order_relaxed);}
+#endif
+
+        /**
+         * @brief Get the file descriptor backing the open connection.
+         * @return Descriptor, or -1 if not open or not available on this platform.
+        */
+        int getFd();
+
+#if defined(__linux__)
+        /**
+         * @brief Switch the communicator to event driven mode.
+         * The connection is registered with the reactor and the handler is
+         * called from the reactor thread whenever data can be read without
+         * blocking. The handler should call read() once per invocation. On
+         * EPOLLHUP or EPOLLERR the handler is responsible for closing the
+         * connection, otherwise it will be called again.
+         *
+         * @param reactor Reactor servicing this connection. Must outlive it.
+         * @param on_data_ready Handler taking the communicator and epoll events.
+        */
+        void attach(Reactor& reactor, std::function<void(Communicator&, uint32_t)> on_data_ready);
+
+        /**
+         * @brief Remove the connection from its reactor, returning to polled mode.
+        */
+        void detach();
+
+        /**
+         * @brief Handler for the link state of a reconnecting connection, see
+         * tcp_reconnect and serial_reconnect. Connecting and reconnecting are driven from within the
+         * read calls, which wait through an outage rather than fail, and the
+         * handler is called from them. A transition to LINK_CONNECTED reports
+         * how long the link was down; data from before it may end part way
+         * through a packet, so callers feeding their own decoder from read()
+         * should reset it. readBatch() resets the decoder it is given.
+         * Must be set before open(). Connections of this kind cannot be
+         * attached to a reactor or use io_uring.
+        */
+        void onLinkStateChange(std::function<void(link_state_e state, uint64_t outage_ms)> handler) {
+            link_state_handler_ = std::move(handler);
+        }
+#endif
+
 
     private:
         #if defined(WIN32) || defined(_WIN32)
@@ -123,12 +270,49 @@ class Communicator{
             int server_ = -1;
         #endif
 
+        // Serial port handle, independent of the global rs232 port table.
+        com_handle_t* serial_ = nullptr;
+
         // Boolean to check if a method is open.
         bool isOpen_ = false;
 
         // Defines what communication method to use, refer to adnav_connection_e.
         adnav_connections_data_t connection_ops_;
 
+#if defined(__linux__)
+        // Reactor the connection is registered with, if any, and the registered descriptor.
+        Reactor* reactor_ = nullptr;
+        int reactor_fd_ = -1;
+
+        // Reconnecting connections. The private reactor is run by the read
+        // calls, and received bytes wait in link_buffer_ until they are read.
+        std::unique_ptr<Reactor> link_reactor_;
+        std::unique_ptr<TcpReconnector> tcp_reconnector_;
+        std::unique_ptr<SerialReconnector> serial_reconnector_;
+        std::vector<uint8_t> link_buffer_;
+        size_t link_offset_ = 0;
+        // Receive time of the first unread byte.
+        uint64_t link_timestamp_ = 0;
+        // Set on reconnection until readBatch() resets its decoder.
+        bool link_restored_ = false;
+        std::function<void(link_state_e, uint64_t)> link_state_handler_;
+#endif
+
+        // File replay state. The capture is either mapped or read through replay_file_.
+        FILE* replay_file_ = nullptr;
+        const uint8_t* replay_map_ = nullptr;
+        size_t replay_size_ = 0;
+        size_t replay_offset_ = 0;
+        // Paced replay decodes ahead to find packet boundaries and times.
+        an_decoder_t replay_decoder_;
+        an_packet_view_t replay_packet_;
+        bool replay_pending_ = false;
+        // Bytes of the pending packet already returned.
+        size_t replay_packet_offset_ = 0;
+        bool replay_paced_ = false;
+        uint64_t replay_device_origin_ = 0;
+        std::chrono::steady_clock::time_point replay_host_origin_;
+
         // Has a UDP Packet been recieved.
         bool UDPDatagramRecv = false;
 
@@ -137,6 +321,37 @@ class Communicator{
         // Lengths of the sockaddr_in structs.
         socklen_t addressLen_, servAddrLen_;
 
+        // Receive buffers for readBatch(), allocated on first use.
+        std::vector<uint8_t> batch_buffer_;
+
+        void datagramReceived();
+        void openReplay();
+        void closeReplay();
+        int readReplay(void* buf, size_t len);
+        size_t replayData(uint8_t* buf, size_t len);
+        bool nextReplayPacket();
+#if defined(__linux__)
+        void openLink();
+        void closeLink();
+        bool pumpLink(int timeout_ms);
+        int takeLink(void* buf, size_t len, uint64_t* timestamp);
+        int writeLink(const struct iovec* buffers, int count);
+        int writeAll(int fd, const struct iovec* buffers, int count);
+        std::vector<struct iovec> write_vectors_;
+        std::atomic<uint64_t> partial_writes_ = {0};
+        std::atomic<uint64_t> write_stalls_ = {0};
+
+        void feedDecoder(an_decoder_t* an_decoder, const uint8_t* data, size_t length, uint64_t timestamp,
+            const std::function<void(const an_packet_view_t&)>& on_packet);
+#endif
+#if defined(ADNAV_HAS_IO_URING)
+        // io_uring receive path, when enabled with useIoUring().
+        std::unique_ptr<UringReceiver> uring_;
+#endif
+#if defined(__linux__)
+        void enableTimestamps();
+#endif
+
         // Private Validation and error handling methods.
         bool validateBaudRate();
         bool validateComPort();
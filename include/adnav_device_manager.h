@@ -0,0 +1,157 @@
+/****************************************************************/
+/*                                                              */
+/*                     Advanced Navigation                      */
+/*                       Device Manager                         */
+/*         Copyright 2023, Advanced Navigation Pty Ltd          */
+/*                                                              */
+/****************************************************************/
+/*
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef ADNAV_DEVICE_MANAGER_H_
+#define ADNAV_DEVICE_MANAGER_H_
+
+#include <stdint.h>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "adnav_comms.h"
+#include "adnav_reactor.h"
+#include "an_packet_protocol.h"
+
+namespace adnav {
+
+#if defined(__linux__)
+
+typedef struct {
+    uint64_t bytes_received;
+    uint64_t packets_decoded;
+    uint64_t bytes_discarded;
+    uint64_t lrc_errors;
+    uint64_t crc_errors;
+    uint64_t read_errors;
+}device_statistics_t;
+
+/**
+ * @brief Owns a set of device connections, each with its own decoder, and
+ * services them from a fixed pool of reactor threads.
+ * Devices are assigned to I/O threads round robin in the order they are
+ * added. Decoded packets are delivered on the I/O thread that owns the
+ * device, tagged with the device index returned by addDevice(), so the
+ * packet handler must be safe to call concurrently when more than one
+ * thread is used.
+*/
+class DeviceManager {
+    public:
+        typedef std::function<void(int device, const an_packet_view_t& an_packet)> packet_handler_t;
+
+        // Should not be clonable
+        DeviceManager(const DeviceManager&) = delete;
+
+        // Should not be assignable
+        DeviceManager& operator=(const DeviceManager&) = delete;
+
+        /**
+         * @brief Constructor
+         * @param io_threads Number of reactor threads to spread devices over.
+        */
+        explicit DeviceManager(int io_threads = 1);
+        ~DeviceManager() {stop();}
+
+        /**
+         * @brief Add a device. Devices can only be added while stopped, as
+         * the device table is shared with the I/O threads.
+         *
+         * @param ops Connection options, see adnav_connections_data_t.
+         * @return Index used to tag packets and query statistics.
+        */
+        int addDevice(const adnav_connections_data_t& ops);
+
+        /**
+         * @brief Set the handler that receives every decoded packet. Must be
+         * set before start().
+        */
+        void onPacket(packet_handler_t handler) {packet_handler_ = std::move(handler);}
+
+        /**
+         * @brief Open every device and start the I/O threads.
+        */
+        void start();
+
+        /**
+         * @brief Stop the I/O threads and close every device.
+        */
+        void stop();
+
+        bool isRunning() {return running_;}
+
+        /**
+         * @brief Write to a device. Safe to call from any thread, including
+         * from within the packet handler.
+        */
+        int write(int device, void* buf, size_t len);
+
+        size_t deviceCount() {return devices_.size();}
+        Communicator& communicator(int device) {return *devices_.at(device)->communicator;}
+
+        /**
+         * @brief Counters for a single device since it was added.
+        */
+        device_statistics_t statistics(int device);
+
+        /**
+         * @brief Sum of the counters of all devices.
+        */
+        device_statistics_t totalStatistics();
+
+    private:
+        struct Device {
+            std::unique_ptr<Communicator> communicator;
+            an_decoder_t decoder;
+            int thread;
+            std::mutex write_mutex;
+            std::atomic<uint64_t> bytes_received = {0};
+            std::atomic<uint64_t> packets_decoded = {0};
+            std::atomic<uint64_t> read_errors = {0};
+            std::atomic<uint64_t> bytes_discarded = {0};
+            std::atomic<uint64_t> lrc_errors = {0};
+            std::atomic<uint64_t> crc_errors = {0};
+        };
+
+        void service(int index, uint32_t events);
+
+        // Reactors are declared first so that they outlive the devices registered with them.
+        std::vector<std::unique_ptr<Reactor>> reactors_;
+        std::vector<std::unique_ptr<Device>> devices_;
+        std::vector<std::thread> threads_;
+        packet_handler_t packet_handler_ = [](int, const an_packet_view_t&) {};
+        bool running_ = false;
+};
+
+#endif // defined(__linux__)
+
+}// namespace adnav
+
+#endif // ADNAV_DEVICE_MANAGER_H_
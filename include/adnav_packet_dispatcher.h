@@ -0,0 +1,191 @@
+/****************************************************************/
+/*                                                              */
+/*                     Advanced Navigation                      */
+/*                      Packet Dispatcher                       */
+/*         Copyright 2023, Advanced Navigation Pty Ltd          */
+/*                                                              */
+/****************************************************************/
+/*
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef ADNAV_PACKET_DISPATCHER_H_
+#define ADNAV_PACKET_DISPATCHER_H_
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "an_packet_protocol.h"
+#include "ins_packets.h"
+#include "adnav_packet_traits.h"
+
+namespace adnav {
+
+/**
+ * @brief Routes decoded ANPP packets to typed handlers through a 256 entry
+ * table indexed by packet id.
+ *
+ * Only packet ids with at least one subscriber are decoded, all others are
+ * counted and skipped without reading their payload. Handlers are registered
+ * with on<T>() where T is one of the packet structures from ins_packets.h, or
+ * with onRaw() to receive the undecoded packet view for any id.
+ *
+ * Registration is not thread safe and should be completed before packets are
+ * dispatched.
+*/
+class PacketDispatcher {
+    public:
+        /**
+         * @brief Per packet id counters.
+        */
+        typedef struct {
+            uint64_t received;
+            uint64_t decode_failures;
+            uint64_t bytes;
+        } packet_statistics_t;
+
+        PacketDispatcher() : statistics_() {}
+
+        // Should not be clonable
+        PacketDispatcher(const PacketDispatcher&) = delete;
+
+        // Should not be assignable
+        PacketDispatcher& operator=(const PacketDispatcher&) = delete;
+
+        /**
+         * @brief Subscribe a handler to a packet structure. The packet is decoded
+         * once per dispatch and passed to every handler subscribed to its id.
+         *
+         * @param handler Callable taking a const T&.
+        */
+        template <typename T, typename F>
+        void on(F&& handler) {
+            Entry& entry = entries_[packet_traits<T>::id];
+            if(!entry.decoder) {
+                auto handlers = std::make_shared<std::vector<std::function<void(const T&)>>>();
+                entry.decoder = [handlers](const an_packet_view_t& an_packet_view) {
+                    T packet;
+                    if(!decode(an_packet_view, packet)) return false;
+                    for(const auto& fn : *handlers) fn(packet);
+                    return true;
+                };
+                entry.typed_handlers = handlers;
+            }
+            std::static_pointer_cast<std::vector<std::function<void(const T&)>>>(entry.typed_handlers)
+                ->emplace_back(std::forward<F>(handler));
+        }
+
+        /**
+         * @brief Subscribe a handler to the undecoded packet view of a packet id.
+         *
+         * @param id Packet id to subscribe to.
+         * @param handler Callable taking a const an_packet_view_t&.
+        */
+        void onRaw(uint8_t id, std::function<void(const an_packet_view_t&)> handler) {
+            entries_[id].raw_handlers.emplace_back(std::move(handler));
+        }
+
+        /**
+         * @brief Remove every handler subscribed to a packet id.
+        */
+        void clear(uint8_t id) {entries_[id] = Entry();}
+
+        /**
+         * @brief Check if a packet id has any subscribers.
+        */
+        bool subscribed(uint8_t id) const {
+            return entries_[id].decoder || !entries_[id].raw_handlers.empty();
+        }
+
+        /**
+         * @brief Route a packet to its subscribers.
+         *
+         * @param an_packet_view View of a decoded packet, see an_packet_decode_view().
+         * @return true if the packet had subscribers and decoded successfully.
+        */
+        bool dispatch(const an_packet_view_t& an_packet_view) {
+            packet_statistics_t& statistics = statistics_[an_packet_view.id];
+            Entry& entry = entries_[an_packet_view.id];
+            statistics.received++;
+            statistics.bytes += AN_PACKET_HEADER_SIZE + an_packet_view.length;
+
+            for(const auto& fn : entry.raw_handlers) fn(an_packet_view);
+
+            if(!entry.decoder) return !entry.raw_handlers.empty();
+            if(!entry.decoder(an_packet_view)) {
+                statistics.decode_failures++;
+                return false;
+            }
+            return true;
+        }
+
+        /**
+         * @brief Route an allocated packet to its subscribers.
+        */
+        bool dispatch(an_packet_t* an_packet) {
+            an_packet_view_t an_packet_view;
+            an_packet_get_view(an_packet, &an_packet_view);
+            return dispatch(an_packet_view);
+        }
+
+        /**
+         * @brief Decode and route every complete packet held by a decoder.
+         *
+         * @return Number of packets dispatched.
+        */
+        int dispatchAll(an_decoder_t* an_decoder) {
+            an_packet_view_t an_packet_view;
+            int count = 0;
+            while(an_packet_decode_view(an_decoder, &an_packet_view)) {
+                dispatch(an_packet_view);
+                count++;
+            }
+            return count;
+        }
+
+        /**
+         * @brief Get the counters for a packet id.
+        */
+        const packet_statistics_t& statistics(uint8_t id) const {return statistics_[id];}
+
+        /**
+         * @brief Reset the counters for every packet id.
+        */
+        void resetStatistics() {statistics_.fill(packet_statistics_t());}
+
+    private:
+        // Decoder shared by the typed handlers of an id, and the handlers themselves.
+        struct Entry {
+            std::function<bool(const an_packet_view_t&)> decoder;
+            std::shared_ptr<void> typed_handlers;
+            std::vector<std::function<void(const an_packet_view_t&)>> raw_handlers;
+        };
+
+        std::array<Entry, 256> entries_;
+        std::array<packet_statistics_t, 256> statistics_;
+};
+
+} // namespace adnav
+
+#endif // ADNAV_PACKET_DISPATCHER_H_
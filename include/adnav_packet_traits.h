@@ -0,0 +1,828 @@
+/****************************************************************/
+/*                                                              */
+/*                     Advanced Navigation                      */
+/*                        Packet Traits                         */
+/*         Copyright 2023, Advanced Navigation Pty Ltd          */
+/*                                                              */
+/****************************************************************/
+/*
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef ADNAV_PACKET_TRAITS_H_
+#define ADNAV_PACKET_TRAITS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "an_packet_protocol.h"
+#include "ins_packets.h"
+
+namespace adnav {
+
+/**
+ * @brief Compile time description of an ANPP packet structure from ins_packets.h.
+ * Provides the packet id and the payload size on the wire, which is 0 for
+ * packets whose length varies. The primary template is left undefined so
+ * that unknown types fail to compile.
+*/
+template <typename T>
+struct packet_traits;
+
+/**
+ * @brief Binds a packet structure to its C view decoder. Only defined for
+ * structures that can be decoded.
+*/
+template <typename T>
+struct packet_decoder;
+
+/**
+ * @brief Binds a packet structure to its C allocation free encoder. Only
+ * defined for structures that can be encoded without extra arguments.
+*/
+template <typename T>
+struct packet_encoder;
+
+/**
+ * @brief Payload layout of a fixed size packet structure, one descriptor per
+ * field in wire order. Defined for every structure whose decoder and encoder
+ * are generated from the layout. Packets whose length varies keep their C
+ * codec from ins_packets.c.
+*/
+template <typename T>
+struct packet_layout;
+
+/**
+ * @brief A structure member of sizeof(Type) * Count bytes at byte Offset of
+ * the payload and byte Member of the structure.
+*/
+template <size_t Offset, size_t Member, typename Type, size_t Count, size_t MemberSize>
+struct packet_field {
+    static_assert(sizeof(Type) * Count == MemberSize, "Field type does not match the structure member");
+    typedef Type type;
+    static constexpr size_t offset = Offset;
+    static constexpr size_t member = Member;
+    static constexpr size_t count = Count;
+    static constexpr size_t size = sizeof(Type) * Count;
+
+    static void load(uint8_t* packet, const uint8_t* data) {memcpy(packet + Member, data + Offset, size);}
+    static void store(uint8_t* data, const uint8_t* packet) {memcpy(data + Offset, packet + Member, size);}
+};
+
+/**
+ * @brief A one byte setting that is encoded as 0 or 1.
+*/
+template <size_t Offset, size_t Member, size_t MemberSize>
+struct packet_flag {
+    static_assert(MemberSize == sizeof(uint8_t), "Flags must be single byte members");
+    static constexpr size_t offset = Offset;
+    static constexpr size_t size = sizeof(uint8_t);
+
+    static void load(uint8_t* packet, const uint8_t* data) {packet[Member] = data[Offset];}
+    static void store(uint8_t* data, const uint8_t* packet) {data[Offset] = packet[Member] > 0;}
+};
+
+/**
+ * @brief Payload bytes with no structure member, skipped when decoding and
+ * zeroed when encoding.
+*/
+template <size_t Offset, size_t Size>
+struct packet_reserved {
+    static constexpr size_t offset = Offset;
+    static constexpr size_t size = Size;
+
+    static void load(uint8_t*, const uint8_t*) {}
+    static void store(uint8_t* data, const uint8_t*) {memset(data + Offset, 0, Size);}
+};
+
+/**
+ * @brief A reserved structure member, decoded as received and zeroed when encoding.
+*/
+template <size_t Offset, size_t Member, typename Type, size_t MemberSize>
+struct packet_reserved_field {
+    static_assert(sizeof(Type) == MemberSize, "Field type does not match the structure member");
+    static constexpr size_t offset = Offset;
+    static constexpr size_t size = sizeof(Type);
+
+    static void load(uint8_t* packet, const uint8_t* data) {memcpy(packet + Member, data + Offset, size);}
+    static void store(uint8_t* data, const uint8_t*) {memset(data + Offset, 0, size);}
+};
+
+/**
+ * @brief Size characters on the wire held in a char array one longer, which
+ * is null terminated when decoding.
+*/
+template <size_t Offset, size_t Member, size_t Size, size_t MemberSize>
+struct packet_string {
+    static_assert(Size + 1 == MemberSize, "String member must hold the characters and a terminator");
+    static constexpr size_t offset = Offset;
+    static constexpr size_t size = Size;
+
+    static void load(uint8_t* packet, const uint8_t* data) {
+        memcpy(packet + Member, data + Offset, Size);
+        packet[Member + Size] = '\0';
+    }
+    static void store(uint8_t* data, const uint8_t* packet) {memcpy(data + Offset, packet + Member, Size);}
+};
+
+/**
+ * @brief A fixed value written by the encoder, such as a verification code.
+*/
+template <size_t Offset, typename Type, Type Value>
+struct packet_constant {
+    static constexpr size_t offset = Offset;
+    static constexpr size_t size = sizeof(Type);
+
+    static void load(uint8_t*, const uint8_t*) {}
+    static void store(uint8_t* data, const uint8_t*) {
+        Type value = Value;
+        memcpy(data + Offset, &value, size);
+    }
+};
+
+/**
+ * @brief An ordered list of field descriptors. The loads and stores expand to
+ * one fixed size copy per field.
+*/
+template <typename... Fields>
+struct packet_fields {
+    /**
+     * @brief Number of payload bytes covered by the fields, or 0 if they are
+     * out of order, overlap or leave a gap.
+    */
+    static constexpr size_t covered() {
+        const size_t offsets[] = {Fields::offset...};
+        const size_t sizes[] = {Fields::size...};
+        size_t end = 0;
+        for(size_t i = 0; i < sizeof...(Fields); i++) {
+            if(offsets[i] != end) return 0;
+            end += sizes[i];
+        }
+        return end;
+    }
+
+    static void load(uint8_t* packet, const uint8_t* data) {
+        int expand[] = {0, (Fields::load(packet, data), 0)...};
+        (void)expand;
+    }
+
+    static void store(uint8_t* data, const uint8_t* packet) {
+        int expand[] = {0, (Fields::store(data, packet), 0)...};
+        (void)expand;
+    }
+};
+
+/**
+ * @brief Decoder generated from packet_layout<T>.
+*/
+template <typename T>
+struct layout_decoder {
+    static int decode(T* packet, const an_packet_view_t* an_packet_view) {
+        if(an_packet_view->id != packet_traits<T>::id || an_packet_view->length != packet_traits<T>::wire_size) return 1;
+        packet_layout<T>::fields::load(reinterpret_cast<uint8_t*>(packet), an_packet_view->data);
+        return 0;
+    }
+};
+
+/**
+ * @brief Encoder generated from packet_layout<T>.
+*/
+template <typename T>
+struct layout_encoder {
+    static int encode(uint8_t* buffer, size_t capacity, const T& packet) {
+        an_packet_view_t an_packet_view;
+        if(!an_packet_view_initialise(&an_packet_view, buffer, capacity, packet_traits<T>::wire_size, packet_traits<T>::id)) return 0;
+        packet_layout<T>::fields::store(an_packet_view.data, reinterpret_cast<const uint8_t*>(&packet));
+        an_packet_view_encode(&an_packet_view);
+        return AN_PACKET_HEADER_SIZE + an_packet_view.length;
+    }
+};
+
+#define ADNAV_PACKET_TRAITS(packet_type, packet_id, packet_wire_size) \
+    template <> \
+    struct packet_traits<packet_type> { \
+        static constexpr uint8_t id = packet_id; \
+        static constexpr size_t wire_size = packet_wire_size; \
+        static constexpr size_t max_frame_size = AN_PACKET_HEADER_SIZE + (packet_wire_size ? packet_wire_size : AN_MAXIMUM_PACKET_SIZE); \
+    };
+
+// The field macros are only used inside ADNAV_PACKET_LAYOUT, which names the structure "packet".
+#define ADNAV_MEMBER_SIZE(member) sizeof(static_cast<packet*>(nullptr)->member)
+#define ADNAV_FIELD(member, offset, type) \
+    packet_field<offset, offsetof(packet, member), type, 1, ADNAV_MEMBER_SIZE(member)>
+#define ADNAV_ARRAY(member, offset, type, count) \
+    packet_field<offset, offsetof(packet, member), type, count, ADNAV_MEMBER_SIZE(member)>
+#define ADNAV_FLAG(member, offset) \
+    packet_flag<offset, offsetof(packet, member), ADNAV_MEMBER_SIZE(member)>
+#define ADNAV_RESERVED(offset, size) \
+    packet_reserved<offset, size>
+#define ADNAV_RESERVED_FIELD(member, offset, type) \
+    packet_reserved_field<offset, offsetof(packet, member), type, ADNAV_MEMBER_SIZE(member)>
+#define ADNAV_STRING(member, offset, size) \
+    packet_string<offset, offsetof(packet, member), size, ADNAV_MEMBER_SIZE(member)>
+#define ADNAV_CONSTANT(offset, type, value) \
+    packet_constant<offset, type, value>
+
+#define ADNAV_PACKET_LAYOUT(packet_type, ...) \
+    template <> \
+    struct packet_layout<packet_type> { \
+        typedef packet_type packet; \
+        typedef packet_fields<__VA_ARGS__> fields; \
+    }; \
+    static_assert(packet_layout<packet_type>::fields::covered() == packet_traits<packet_type>::wire_size, \
+        "Layout of " #packet_type " must cover its payload in order");
+
+#define ADNAV_PACKET_DECODER(packet_type) \
+    template <> \
+    struct packet_decoder<packet_type> : layout_decoder<packet_type> {};
+
+#define ADNAV_PACKET_ENCODER(packet_type) \
+    template <> \
+    struct packet_encoder<packet_type> : layout_encoder<packet_type> {};
+
+// Packets whose length varies are decoded and encoded by their C functions.
+#define ADNAV_PACKET_C_DECODER(packet_type, decoder) \
+    template <> \
+    struct packet_decoder<packet_type> { \
+        static int decode(packet_type* packet, const an_packet_view_t* an_packet_view) { \
+            return decoder##_view(packet, an_packet_view); \
+        } \
+    };
+
+#define ADNAV_PACKET_C_ENCODER(packet_type, encoder) \
+    template <> \
+    struct packet_encoder<packet_type> { \
+        static int encode(uint8_t* buffer, size_t capacity, const packet_type& packet) { \
+            return encoder##_into(buffer, capacity, const_cast<packet_type*>(&packet)); \
+        } \
+    };
+
+ADNAV_PACKET_TRAITS(acknowledge_packet_t, packet_id_acknowledge, 4)
+ADNAV_PACKET_LAYOUT(acknowledge_packet_t,
+    ADNAV_FIELD(packet_id, 0, uint8_t),
+    ADNAV_FIELD(packet_crc, 1, uint16_t),
+    ADNAV_FIELD(acknowledge_result, 3, uint8_t))
+ADNAV_PACKET_DECODER(acknowledge_packet_t)
+ADNAV_PACKET_TRAITS(boot_mode_packet_t, packet_id_boot_mode, 1)
+ADNAV_PACKET_LAYOUT(boot_mode_packet_t,
+    ADNAV_FIELD(boot_mode, 0, uint8_t))
+ADNAV_PACKET_DECODER(boot_mode_packet_t)
+ADNAV_PACKET_ENCODER(boot_mode_packet_t)
+ADNAV_PACKET_TRAITS(device_information_packet_t, packet_id_device_information, 24)
+ADNAV_PACKET_LAYOUT(device_information_packet_t,
+    ADNAV_FIELD(software_version, 0, uint32_t),
+    ADNAV_FIELD(device_id, 4, uint32_t),
+    ADNAV_FIELD(hardware_revision, 8, uint32_t),
+    ADNAV_ARRAY(serial_number, 12, uint32_t, 3))
+ADNAV_PACKET_DECODER(device_information_packet_t)
+ADNAV_PACKET_TRAITS(file_transfer_acknowledge_packet_t, packet_id_file_transfer_acknowledge, 9)
+ADNAV_PACKET_LAYOUT(file_transfer_acknowledge_packet_t,
+    ADNAV_FIELD(unique_id, 0, uint32_t),
+    ADNAV_FIELD(data_index, 4, uint32_t),
+    ADNAV_FIELD(response_code, 8, uint8_t))
+ADNAV_PACKET_DECODER(file_transfer_acknowledge_packet_t)
+ADNAV_PACKET_TRAITS(serial_port_passthrough_packet_t, packet_id_serial_port_passthrough, 0)
+ADNAV_PACKET_C_DECODER(serial_port_passthrough_packet_t, decode_serial_port_passthrough_packet)
+ADNAV_PACKET_TRAITS(ip_configuration_packet_t, packet_id_ip_configuration, 30)
+ADNAV_PACKET_LAYOUT(ip_configuration_packet_t,
+    ADNAV_FIELD(permanent, 0, uint8_t),
+    ADNAV_FIELD(dhcp_mode, 1, uint8_t),
+    ADNAV_FIELD(ip_address, 2, uint32_t),
+    ADNAV_FIELD(ip_netmask, 6, uint32_t),
+    ADNAV_FIELD(ip_gateway, 10, uint32_t),
+    ADNAV_FIELD(dns_server, 14, uint32_t),
+    ADNAV_ARRAY(serial_number, 18, uint32_t, 3))
+ADNAV_PACKET_DECODER(ip_configuration_packet_t)
+ADNAV_PACKET_ENCODER(ip_configuration_packet_t)
+ADNAV_PACKET_TRAITS(subcomponent_information_packet_t, packet_id_subcomponent_information, 0)
+ADNAV_PACKET_C_DECODER(subcomponent_information_packet_t, decode_subcomponent_information_packet)
+ADNAV_PACKET_TRAITS(system_state_packet_t, packet_id_system_state, 100)
+ADNAV_PACKET_LAYOUT(system_state_packet_t,
+    ADNAV_FIELD(system_status, 0, uint16_t),
+    ADNAV_FIELD(filter_status, 2, uint16_t),
+    ADNAV_FIELD(unix_time_seconds, 4, uint32_t),
+    ADNAV_FIELD(microseconds, 8, uint32_t),
+    ADNAV_FIELD(latitude, 12, double),
+    ADNAV_FIELD(longitude, 20, double),
+    ADNAV_FIELD(height, 28, double),
+    ADNAV_ARRAY(velocity, 36, float, 3),
+    ADNAV_ARRAY(body_acceleration, 48, float, 3),
+    ADNAV_FIELD(g_force, 60, float),
+    ADNAV_ARRAY(orientation, 64, float, 3),
+    ADNAV_ARRAY(angular_velocity, 76, float, 3),
+    ADNAV_ARRAY(standard_deviation, 88, float, 3))
+ADNAV_PACKET_DECODER(system_state_packet_t)
+ADNAV_PACKET_TRAITS(unix_time_packet_t, packet_id_unix_time, 8)
+ADNAV_PACKET_LAYOUT(unix_time_packet_t,
+    ADNAV_FIELD(unix_time_seconds, 0, uint32_t),
+    ADNAV_FIELD(microseconds, 4, uint32_t))
+ADNAV_PACKET_DECODER(unix_time_packet_t)
+ADNAV_PACKET_TRAITS(formatted_time_packet_t, packet_id_formatted_time, 14)
+ADNAV_PACKET_LAYOUT(formatted_time_packet_t,
+    ADNAV_FIELD(microseconds, 0, uint32_t),
+    ADNAV_FIELD(year, 4, uint16_t),
+    ADNAV_FIELD(year_day, 6, uint16_t),
+    ADNAV_FIELD(month, 8, uint8_t),
+    ADNAV_FIELD(month_day, 9, uint8_t),
+    ADNAV_FIELD(week_day, 10, uint8_t),
+    ADNAV_FIELD(hour, 11, uint8_t),
+    ADNAV_FIELD(minute, 12, uint8_t),
+    ADNAV_FIELD(second, 13, uint8_t))
+ADNAV_PACKET_DECODER(formatted_time_packet_t)
+ADNAV_PACKET_TRAITS(status_packet_t, packet_id_status, 4)
+ADNAV_PACKET_LAYOUT(status_packet_t,
+    ADNAV_FIELD(system_status, 0, uint16_t),
+    ADNAV_FIELD(filter_status, 2, uint16_t))
+ADNAV_PACKET_DECODER(status_packet_t)
+ADNAV_PACKET_TRAITS(position_standard_deviation_packet_t, packet_id_position_standard_deviation, 12)
+ADNAV_PACKET_LAYOUT(position_standard_deviation_packet_t,
+    ADNAV_ARRAY(standard_deviation, 0, float, 3))
+ADNAV_PACKET_DECODER(position_standard_deviation_packet_t)
+ADNAV_PACKET_TRAITS(velocity_standard_deviation_packet_t, packet_id_velocity_standard_deviation, 12)
+ADNAV_PACKET_LAYOUT(velocity_standard_deviation_packet_t,
+    ADNAV_ARRAY(standard_deviation, 0, float, 3))
+ADNAV_PACKET_DECODER(velocity_standard_deviation_packet_t)
+ADNAV_PACKET_TRAITS(euler_orientation_standard_deviation_packet_t, packet_id_euler_orientation_standard_deviation, 12)
+ADNAV_PACKET_LAYOUT(euler_orientation_standard_deviation_packet_t,
+    ADNAV_ARRAY(standard_deviation, 0, float, 3))
+ADNAV_PACKET_DECODER(euler_orientation_standard_deviation_packet_t)
+ADNAV_PACKET_TRAITS(quaternion_orientation_standard_deviation_packet_t, packet_id_quaternion_orientation_standard_deviation, 16)
+ADNAV_PACKET_LAYOUT(quaternion_orientation_standard_deviation_packet_t,
+    ADNAV_ARRAY(standard_deviation, 0, float, 4))
+ADNAV_PACKET_DECODER(quaternion_orientation_standard_deviation_packet_t)
+ADNAV_PACKET_TRAITS(raw_sensors_packet_t, packet_id_raw_sensors, 48)
+ADNAV_PACKET_LAYOUT(raw_sensors_packet_t,
+    ADNAV_ARRAY(accelerometers, 0, float, 3),
+    ADNAV_ARRAY(gyroscopes, 12, float, 3),
+    ADNAV_ARRAY(magnetometers, 24, float, 3),
+    ADNAV_FIELD(imu_temperature, 36, float),
+    ADNAV_FIELD(pressure, 40, float),
+    ADNAV_FIELD(pressure_temperature, 44, float))
+ADNAV_PACKET_DECODER(raw_sensors_packet_t)
+ADNAV_PACKET_TRAITS(raw_gnss_packet_t, packet_id_raw_gnss, 74)
+ADNAV_PACKET_LAYOUT(raw_gnss_packet_t,
+    ADNAV_FIELD(unix_time_seconds, 0, uint32_t),
+    ADNAV_FIELD(microseconds, 4, uint32_t),
+    ADNAV_ARRAY(position, 8, double, 3),
+    ADNAV_ARRAY(velocity, 32, float, 3),
+    ADNAV_ARRAY(position_standard_deviation, 44, float, 3),
+    ADNAV_FIELD(tilt, 56, float),
+    ADNAV_FIELD(heading, 60, float),
+    ADNAV_FIELD(tilt_standard_deviation, 64, float),
+    ADNAV_FIELD(heading_standard_deviation, 68, float),
+    ADNAV_FIELD(flags.r, 72, uint16_t))
+ADNAV_PACKET_DECODER(raw_gnss_packet_t)
+ADNAV_PACKET_ENCODER(raw_gnss_packet_t)
+ADNAV_PACKET_TRAITS(satellites_packet_t, packet_id_satellites, 13)
+ADNAV_PACKET_LAYOUT(satellites_packet_t,
+    ADNAV_FIELD(hdop, 0, float),
+    ADNAV_FIELD(vdop, 4, float),
+    ADNAV_FIELD(gps_satellites, 8, uint8_t),
+    ADNAV_FIELD(glonass_satellites, 9, uint8_t),
+    ADNAV_FIELD(beidou_satellites, 10, uint8_t),
+    ADNAV_FIELD(galileo_satellites, 11, uint8_t),
+    ADNAV_FIELD(sbas_satellites, 12, uint8_t))
+ADNAV_PACKET_DECODER(satellites_packet_t)
+ADNAV_PACKET_TRAITS(geodetic_position_packet_t, packet_id_geodetic_position, 24)
+ADNAV_PACKET_LAYOUT(geodetic_position_packet_t,
+    ADNAV_ARRAY(position, 0, double, 3))
+ADNAV_PACKET_DECODER(geodetic_position_packet_t)
+ADNAV_PACKET_TRAITS(ecef_position_packet_t, packet_id_ecef_position, 24)
+ADNAV_PACKET_LAYOUT(ecef_position_packet_t,
+    ADNAV_ARRAY(position, 0, double, 3))
+ADNAV_PACKET_DECODER(ecef_position_packet_t)
+ADNAV_PACKET_TRAITS(utm_position_packet_t, packet_id_utm_position, 26)
+ADNAV_PACKET_LAYOUT(utm_position_packet_t,
+    ADNAV_ARRAY(position, 0, double, 3),
+    ADNAV_FIELD(zone_number, 24, uint8_t),
+    ADNAV_FIELD(zone_char, 25, uint8_t))
+ADNAV_PACKET_DECODER(utm_position_packet_t)
+ADNAV_PACKET_TRAITS(ned_velocity_packet_t, packet_id_ned_velocity, 12)
+ADNAV_PACKET_LAYOUT(ned_velocity_packet_t,
+    ADNAV_ARRAY(velocity, 0, float, 3))
+ADNAV_PACKET_DECODER(ned_velocity_packet_t)
+ADNAV_PACKET_TRAITS(body_velocity_packet_t, packet_id_body_velocity, 12)
+ADNAV_PACKET_LAYOUT(body_velocity_packet_t,
+    ADNAV_ARRAY(velocity, 0, float, 3))
+ADNAV_PACKET_DECODER(body_velocity_packet_t)
+ADNAV_PACKET_TRAITS(acceleration_packet_t, packet_id_acceleration, 12)
+ADNAV_PACKET_LAYOUT(acceleration_packet_t,
+    ADNAV_ARRAY(acceleration, 0, float, 3))
+ADNAV_PACKET_DECODER(acceleration_packet_t)
+ADNAV_PACKET_TRAITS(body_acceleration_packet_t, packet_id_body_acceleration, 16)
+ADNAV_PACKET_LAYOUT(body_acceleration_packet_t,
+    ADNAV_ARRAY(acceleration, 0, float, 3),
+    ADNAV_FIELD(g_force, 12, float))
+ADNAV_PACKET_DECODER(body_acceleration_packet_t)
+ADNAV_PACKET_TRAITS(euler_orientation_packet_t, packet_id_euler_orientation, 12)
+ADNAV_PACKET_LAYOUT(euler_orientation_packet_t,
+    ADNAV_ARRAY(orientation, 0, float, 3))
+ADNAV_PACKET_DECODER(euler_orientation_packet_t)
+ADNAV_PACKET_TRAITS(quaternion_orientation_packet_t, packet_id_quaternion_orientation, 16)
+ADNAV_PACKET_LAYOUT(quaternion_orientation_packet_t,
+    ADNAV_ARRAY(orientation, 0, float, 4))
+ADNAV_PACKET_DECODER(quaternion_orientation_packet_t)
+ADNAV_PACKET_TRAITS(dcm_orientation_packet_t, packet_id_dcm_orientation, 36)
+ADNAV_PACKET_LAYOUT(dcm_orientation_packet_t,
+    ADNAV_ARRAY(orientation, 0, float, 9))
+ADNAV_PACKET_DECODER(dcm_orientation_packet_t)
+ADNAV_PACKET_TRAITS(angular_velocity_packet_t, packet_id_angular_velocity, 12)
+ADNAV_PACKET_LAYOUT(angular_velocity_packet_t,
+    ADNAV_ARRAY(angular_velocity, 0, float, 3))
+ADNAV_PACKET_DECODER(angular_velocity_packet_t)
+ADNAV_PACKET_TRAITS(angular_acceleration_packet_t, packet_id_angular_acceleration, 12)
+ADNAV_PACKET_LAYOUT(angular_acceleration_packet_t,
+    ADNAV_ARRAY(angular_acceleration, 0, float, 3))
+ADNAV_PACKET_DECODER(angular_acceleration_packet_t)
+ADNAV_PACKET_TRAITS(external_position_velocity_packet_t, packet_id_external_position_velocity, 60)
+ADNAV_PACKET_LAYOUT(external_position_velocity_packet_t,
+    ADNAV_ARRAY(position, 0, double, 3),
+    ADNAV_ARRAY(velocity, 24, float, 3),
+    ADNAV_ARRAY(position_standard_deviation, 36, float, 3),
+    ADNAV_ARRAY(velocity_standard_deviation, 48, float, 3))
+ADNAV_PACKET_DECODER(external_position_velocity_packet_t)
+ADNAV_PACKET_ENCODER(external_position_velocity_packet_t)
+ADNAV_PACKET_TRAITS(external_position_packet_t, packet_id_external_position, 36)
+ADNAV_PACKET_LAYOUT(external_position_packet_t,
+    ADNAV_ARRAY(position, 0, double, 3),
+    ADNAV_ARRAY(standard_deviation, 24, float, 3))
+ADNAV_PACKET_DECODER(external_position_packet_t)
+ADNAV_PACKET_ENCODER(external_position_packet_t)
+ADNAV_PACKET_TRAITS(external_velocity_packet_t, packet_id_external_velocity, 24)
+ADNAV_PACKET_LAYOUT(external_velocity_packet_t,
+    ADNAV_ARRAY(velocity, 0, float, 3),
+    ADNAV_ARRAY(standard_deviation, 12, float, 3))
+ADNAV_PACKET_DECODER(external_velocity_packet_t)
+ADNAV_PACKET_ENCODER(external_velocity_packet_t)
+ADNAV_PACKET_TRAITS(external_body_velocity_packet_t, packet_id_external_body_velocity, 16)
+ADNAV_PACKET_LAYOUT(external_body_velocity_packet_t,
+    ADNAV_ARRAY(velocity, 0, float, 3),
+    ADNAV_FIELD(standard_deviation, 12, float))
+ADNAV_PACKET_DECODER(external_body_velocity_packet_t)
+ADNAV_PACKET_ENCODER(external_body_velocity_packet_t)
+ADNAV_PACKET_TRAITS(external_heading_packet_t, packet_id_external_heading, 8)
+ADNAV_PACKET_LAYOUT(external_heading_packet_t,
+    ADNAV_FIELD(heading, 0, float),
+    ADNAV_FIELD(standard_deviation, 4, float))
+ADNAV_PACKET_DECODER(external_heading_packet_t)
+ADNAV_PACKET_ENCODER(external_heading_packet_t)
+ADNAV_PACKET_TRAITS(running_time_packet_t, packet_id_running_time, 8)
+ADNAV_PACKET_LAYOUT(running_time_packet_t,
+    ADNAV_FIELD(seconds, 0, uint32_t),
+    ADNAV_FIELD(microseconds, 4, uint32_t))
+ADNAV_PACKET_DECODER(running_time_packet_t)
+ADNAV_PACKET_TRAITS(local_magnetics_packet_t, packet_id_local_magnetics, 12)
+ADNAV_PACKET_LAYOUT(local_magnetics_packet_t,
+    ADNAV_ARRAY(magnetic_field, 0, float, 3))
+ADNAV_PACKET_DECODER(local_magnetics_packet_t)
+ADNAV_PACKET_TRAITS(odometer_state_packet_t, packet_id_odometer_state, 20)
+ADNAV_PACKET_LAYOUT(odometer_state_packet_t,
+    ADNAV_FIELD(pulse_count, 0, int32_t),
+    ADNAV_FIELD(distance, 4, float),
+    ADNAV_FIELD(speed, 8, float),
+    ADNAV_FIELD(slip, 12, float),
+    ADNAV_FIELD(active, 16, uint8_t),
+    ADNAV_RESERVED(17, 3))
+ADNAV_PACKET_DECODER(odometer_state_packet_t)
+ADNAV_PACKET_TRAITS(external_time_packet_t, packet_id_external_time, 8)
+ADNAV_PACKET_LAYOUT(external_time_packet_t,
+    ADNAV_FIELD(unix_time_seconds, 0, float),
+    ADNAV_FIELD(microseconds, 4, float))
+ADNAV_PACKET_DECODER(external_time_packet_t)
+ADNAV_PACKET_ENCODER(external_time_packet_t)
+ADNAV_PACKET_TRAITS(external_depth_packet_t, packet_id_external_depth, 8)
+ADNAV_PACKET_LAYOUT(external_depth_packet_t,
+    ADNAV_FIELD(depth, 0, float),
+    ADNAV_FIELD(standard_deviation, 4, float))
+ADNAV_PACKET_DECODER(external_depth_packet_t)
+ADNAV_PACKET_ENCODER(external_depth_packet_t)
+ADNAV_PACKET_TRAITS(geoid_height_packet_t, packet_id_geoid_height, 4)
+ADNAV_PACKET_LAYOUT(geoid_height_packet_t,
+    ADNAV_FIELD(geoid_height, 0, float))
+ADNAV_PACKET_DECODER(geoid_height_packet_t)
+ADNAV_PACKET_TRAITS(wind_packet_t, packet_id_wind, 12)
+ADNAV_PACKET_LAYOUT(wind_packet_t,
+    ADNAV_ARRAY(wind_velocity, 0, float, 2),
+    ADNAV_FIELD(wind_standard_deviation, 8, float))
+ADNAV_PACKET_DECODER(wind_packet_t)
+ADNAV_PACKET_ENCODER(wind_packet_t)
+ADNAV_PACKET_TRAITS(heave_packet_t, packet_id_heave, 16)
+ADNAV_PACKET_LAYOUT(heave_packet_t,
+    ADNAV_FIELD(heave_point_1, 0, float),
+    ADNAV_FIELD(heave_point_2, 4, float),
+    ADNAV_FIELD(heave_point_3, 8, float),
+    ADNAV_FIELD(heave_point_4, 12, float))
+ADNAV_PACKET_DECODER(heave_packet_t)
+ADNAV_PACKET_TRAITS(raw_satellite_ephemeris_packet_t, packet_id_raw_satellite_ephemeris, 0)
+ADNAV_PACKET_C_DECODER(raw_satellite_ephemeris_packet_t, decode_raw_satellite_ephemeris_packet)
+ADNAV_PACKET_TRAITS(odometer_packet_t, packet_id_external_odometer, 13)
+ADNAV_PACKET_LAYOUT(odometer_packet_t,
+    ADNAV_FIELD(delay, 0, float),
+    ADNAV_FIELD(speed, 4, float),
+    ADNAV_FIELD(distance_travelled, 8, float),
+    ADNAV_FIELD(flags.r, 12, uint8_t))
+ADNAV_PACKET_DECODER(odometer_packet_t)
+ADNAV_PACKET_ENCODER(odometer_packet_t)
+ADNAV_PACKET_TRAITS(external_air_data_packet_t, packet_id_external_air_data, 25)
+ADNAV_PACKET_LAYOUT(external_air_data_packet_t,
+    ADNAV_FIELD(barometric_altitude_delay, 0, float),
+    ADNAV_FIELD(airspeed_delay, 4, float),
+    ADNAV_FIELD(barometric_altitude, 8, float),
+    ADNAV_FIELD(airspeed, 12, float),
+    ADNAV_FIELD(barometric_altitude_standard_deviation, 16, float),
+    ADNAV_FIELD(airspeed_standard_deviation, 20, float),
+    ADNAV_FIELD(flags.r, 24, uint8_t))
+ADNAV_PACKET_DECODER(external_air_data_packet_t)
+ADNAV_PACKET_ENCODER(external_air_data_packet_t)
+ADNAV_PACKET_TRAITS(gnss_receiver_information_packet_t, packet_id_gnss_receiver_information, 48)
+ADNAV_PACKET_LAYOUT(gnss_receiver_information_packet_t,
+    ADNAV_FIELD(gnss_manufacturer_id, 0, uint8_t),
+    ADNAV_FIELD(gnss_receiver_model, 1, uint8_t),
+    ADNAV_STRING(serial_number, 2, 10),
+    ADNAV_FIELD(firmware_version, 12, uint32_t),
+    ADNAV_ARRAY(software_license, 16, uint32_t, 3),
+    ADNAV_FIELD(omnistar_serial_number, 28, uint32_t),
+    ADNAV_FIELD(omnistar_subscription_start_unix_time, 32, uint32_t),
+    ADNAV_FIELD(omnistar_subscription_expiry_unix_time, 36, uint32_t),
+    ADNAV_FIELD(omnistar_engine_mode, 40, uint8_t),
+    ADNAV_FIELD(rtk_accuracy, 41, uint8_t),
+    ADNAV_RESERVED(42, 6))
+ADNAV_PACKET_DECODER(gnss_receiver_information_packet_t)
+ADNAV_PACKET_TRAITS(raw_dvl_data_packet_t, packet_id_raw_dvl_data, 60)
+ADNAV_PACKET_LAYOUT(raw_dvl_data_packet_t,
+    ADNAV_FIELD(unix_timestamp, 0, uint32_t),
+    ADNAV_FIELD(microseconds, 4, uint32_t),
+    ADNAV_FIELD(status.r, 8, uint32_t),
+    ADNAV_ARRAY(bottom_velocity, 12, float, 3),
+    ADNAV_FIELD(bottom_velocity_standard_deviation, 24, float),
+    ADNAV_ARRAY(water_velocity, 28, float, 3),
+    ADNAV_FIELD(water_velocity_standard_deviation, 40, float),
+    ADNAV_FIELD(water_velocity_layer_depth, 44, float),
+    ADNAV_FIELD(depth, 48, float),
+    ADNAV_FIELD(altitude, 52, float),
+    ADNAV_FIELD(temperature, 56, float))
+ADNAV_PACKET_DECODER(raw_dvl_data_packet_t)
+ADNAV_PACKET_TRAITS(north_seeking_status_packet_t, packet_id_north_seeking_status, 28)
+ADNAV_PACKET_LAYOUT(north_seeking_status_packet_t,
+    ADNAV_FIELD(north_seeking_status.r, 0, uint16_t),
+    ADNAV_RESERVED(2, 2),
+    ADNAV_ARRAY(quadrant_data_collection_progress, 4, uint8_t, 4),
+    ADNAV_FIELD(current_rotation_angle, 8, float),
+    ADNAV_ARRAY(current_gyroscope_bias_solution, 12, float, 3),
+    ADNAV_FIELD(current_gyroscope_bias_solution_error, 24, float))
+ADNAV_PACKET_DECODER(north_seeking_status_packet_t)
+ADNAV_PACKET_TRAITS(gimbal_state_packet_t, packet_id_gimbal_state, 8)
+ADNAV_PACKET_LAYOUT(gimbal_state_packet_t,
+    ADNAV_FIELD(current_angle, 0, float),
+    ADNAV_RESERVED(4, 4))
+ADNAV_PACKET_DECODER(gimbal_state_packet_t)
+ADNAV_PACKET_ENCODER(gimbal_state_packet_t)
+ADNAV_PACKET_TRAITS(automotive_packet_t, packet_id_automotive, 24)
+ADNAV_PACKET_LAYOUT(automotive_packet_t,
+    ADNAV_FIELD(virtual_odometer_distance, 0, float),
+    ADNAV_FIELD(slip_angle, 4, float),
+    ADNAV_FIELD(velocity_x, 8, float),
+    ADNAV_FIELD(velocity_y, 12, float),
+    ADNAV_FIELD(distance_standard_deviation, 16, float),
+    ADNAV_RESERVED(20, 4))
+ADNAV_PACKET_DECODER(automotive_packet_t)
+ADNAV_PACKET_TRAITS(external_magnetometers_packet_t, packet_id_external_magnetometers, 17)
+ADNAV_PACKET_LAYOUT(external_magnetometers_packet_t,
+    ADNAV_FIELD(delay, 0, float),
+    ADNAV_ARRAY(magnetometer, 4, float, 3),
+    ADNAV_FIELD(flags, 16, uint8_t))
+ADNAV_PACKET_DECODER(external_magnetometers_packet_t)
+ADNAV_PACKET_ENCODER(external_magnetometers_packet_t)
+ADNAV_PACKET_TRAITS(extended_satellites_packet_t, packet_id_extended_satellites, 0)
+ADNAV_PACKET_C_DECODER(extended_satellites_packet_t, decode_extended_satellites_packet)
+ADNAV_PACKET_TRAITS(packet_timer_period_packet_t, packet_id_packet_timer_period, 4)
+ADNAV_PACKET_LAYOUT(packet_timer_period_packet_t,
+    ADNAV_FLAG(permanent, 0),
+    ADNAV_FLAG(utc_synchronisation, 1),
+    ADNAV_FIELD(packet_timer_period, 2, uint16_t))
+ADNAV_PACKET_DECODER(packet_timer_period_packet_t)
+ADNAV_PACKET_ENCODER(packet_timer_period_packet_t)
+ADNAV_PACKET_TRAITS(packet_periods_packet_t, packet_id_packet_periods, 0)
+ADNAV_PACKET_C_DECODER(packet_periods_packet_t, decode_packet_periods_packet)
+ADNAV_PACKET_C_ENCODER(packet_periods_packet_t, encode_packet_periods_packet)
+ADNAV_PACKET_TRAITS(baud_rates_packet_t, packet_id_baud_rates, 17)
+ADNAV_PACKET_LAYOUT(baud_rates_packet_t,
+    ADNAV_FIELD(permanent, 0, uint8_t),
+    ADNAV_FIELD(primary_baud_rate, 1, uint32_t),
+    ADNAV_FIELD(gpio_1_2_baud_rate, 5, uint32_t),
+    ADNAV_FIELD(auxiliary_baud_rate, 9, uint32_t),
+    ADNAV_FIELD(reserved, 13, uint32_t))
+ADNAV_PACKET_DECODER(baud_rates_packet_t)
+ADNAV_PACKET_ENCODER(baud_rates_packet_t)
+ADNAV_PACKET_TRAITS(installation_alignment_packet_t, packet_id_installation_alignment, 73)
+ADNAV_PACKET_LAYOUT(installation_alignment_packet_t,
+    ADNAV_FIELD(permanent, 0, uint8_t),
+    ADNAV_ARRAY(alignment_dcm, 1, float, 9),
+    ADNAV_ARRAY(gnss_antenna_offset, 37, float, 3),
+    ADNAV_ARRAY(odometer_offset, 49, float, 3),
+    ADNAV_ARRAY(external_data_offset, 61, float, 3))
+ADNAV_PACKET_DECODER(installation_alignment_packet_t)
+ADNAV_PACKET_ENCODER(installation_alignment_packet_t)
+ADNAV_PACKET_TRAITS(filter_options_packet_t, packet_id_filter_options, 17)
+ADNAV_PACKET_LAYOUT(filter_options_packet_t,
+    ADNAV_FIELD(permanent, 0, uint8_t),
+    ADNAV_FIELD(vehicle_type, 1, uint8_t),
+    ADNAV_FIELD(internal_gnss_enabled, 2, uint8_t),
+    ADNAV_FIELD(magnetometers_enabled, 3, uint8_t),
+    ADNAV_FIELD(atmospheric_altitude_enabled, 4, uint8_t),
+    ADNAV_FIELD(velocity_heading_enabled, 5, uint8_t),
+    ADNAV_FIELD(reversing_detection_enabled, 6, uint8_t),
+    ADNAV_FIELD(motion_analysis_enabled, 7, uint8_t),
+    ADNAV_FIELD(reserved8, 8, uint8_t),
+    ADNAV_RESERVED(9, 8))
+ADNAV_PACKET_DECODER(filter_options_packet_t)
+ADNAV_PACKET_ENCODER(filter_options_packet_t)
+ADNAV_PACKET_TRAITS(gpio_configuration_packet_t, packet_id_gpio_configuration, 13)
+ADNAV_PACKET_LAYOUT(gpio_configuration_packet_t,
+    ADNAV_FIELD(permanent, 0, uint8_t),
+    ADNAV_ARRAY(gpio_function, 1, uint8_t, 4),
+    ADNAV_FIELD(gpio_voltage_selection, 5, uint8_t),
+    ADNAV_RESERVED(6, 7))
+ADNAV_PACKET_DECODER(gpio_configuration_packet_t)
+ADNAV_PACKET_ENCODER(gpio_configuration_packet_t)
+ADNAV_PACKET_TRAITS(odometer_configuration_packet_t, packet_id_odometer_configuration, 8)
+ADNAV_PACKET_LAYOUT(odometer_configuration_packet_t,
+    ADNAV_FIELD(permanent, 0, uint8_t),
+    ADNAV_FIELD(automatic_calibration, 1, uint8_t),
+    ADNAV_RESERVED(2, 2),
+    ADNAV_FIELD(pulse_length, 4, float))
+ADNAV_PACKET_DECODER(odometer_configuration_packet_t)
+ADNAV_PACKET_ENCODER(odometer_configuration_packet_t)
+ADNAV_PACKET_TRAITS(heave_offset_packet_t, packet_id_reference_offsets, 49)
+ADNAV_PACKET_LAYOUT(heave_offset_packet_t,
+    ADNAV_FIELD(permanent, 0, uint8_t),
+    ADNAV_ARRAY(heave_point_1_offset, 1, float, 3),
+    ADNAV_ARRAY(heave_point_2_offset, 13, float, 3),
+    ADNAV_ARRAY(heave_point_3_offset, 25, float, 3),
+    ADNAV_ARRAY(heave_point_4_offset, 37, float, 3))
+ADNAV_PACKET_DECODER(heave_offset_packet_t)
+ADNAV_PACKET_ENCODER(heave_offset_packet_t)
+ADNAV_PACKET_TRAITS(gpio_output_configuration_packet_t, packet_id_gpio_output_configuration, 183)
+ADNAV_PACKET_LAYOUT(gpio_output_configuration_packet_t,
+    ADNAV_FIELD(permanent, 0, uint8_t),
+    ADNAV_ARRAY(auxiliary_port, 1, uint8_t, 18),
+    ADNAV_RESERVED(19, 8),
+    ADNAV_ARRAY(gpio_port, 27, uint8_t, 18),
+    ADNAV_RESERVED(45, 8),
+    ADNAV_ARRAY(logging_port, 53, uint8_t, 18),
+    ADNAV_RESERVED(71, 8),
+    ADNAV_ARRAY(data_port_1, 79, uint8_t, 18),
+    ADNAV_RESERVED(97, 8),
+    ADNAV_ARRAY(data_port_2, 105, uint8_t, 18),
+    ADNAV_RESERVED(123, 8),
+    ADNAV_ARRAY(data_port_3, 131, uint8_t, 18),
+    ADNAV_RESERVED(149, 8),
+    ADNAV_ARRAY(data_port_4, 157, uint8_t, 18),
+    ADNAV_RESERVED(175, 8))
+ADNAV_PACKET_DECODER(gpio_output_configuration_packet_t)
+ADNAV_PACKET_ENCODER(gpio_output_configuration_packet_t)
+ADNAV_PACKET_TRAITS(dual_antenna_configuration_packet_t, packet_id_dual_antenna_configuration, 17)
+ADNAV_PACKET_LAYOUT(dual_antenna_configuration_packet_t,
+    ADNAV_FIELD(permanent, 0, uint8_t),
+    ADNAV_FIELD(options.r, 1, uint16_t),
+    ADNAV_FIELD(automatic_offset_orientation, 3, uint8_t),
+    ADNAV_RESERVED_FIELD(reserved, 4, uint8_t),
+    ADNAV_ARRAY(manual_offset, 5, float, 3))
+ADNAV_PACKET_DECODER(dual_antenna_configuration_packet_t)
+ADNAV_PACKET_ENCODER(dual_antenna_configuration_packet_t)
+ADNAV_PACKET_TRAITS(gnss_configuration_packet_t, packet_id_gnss_configuration, 85)
+ADNAV_PACKET_LAYOUT(gnss_configuration_packet_t,
+    ADNAV_FIELD(permanent, 0, uint8_t),
+    ADNAV_FIELD(gnss_frequencies, 1, uint64_t),
+    ADNAV_FIELD(pdop, 9, float),
+    ADNAV_FIELD(tdop, 13, float),
+    ADNAV_FIELD(elevation_mask, 17, uint8_t),
+    ADNAV_FIELD(snr_mask, 18, uint8_t),
+    ADNAV_FIELD(sbas_corrections_enabled, 19, uint8_t),
+    ADNAV_FIELD(lband_mode, 20, uint8_t),
+    ADNAV_FIELD(lband_frequency, 21, uint32_t),
+    ADNAV_FIELD(lband_baud, 25, uint32_t),
+    ADNAV_FIELD(primary_antenna_type, 29, uint32_t),
+    ADNAV_FIELD(secondary_antenna_type, 33, uint32_t),
+    ADNAV_FIELD(lband_satellite_id, 37, uint8_t),
+    ADNAV_RESERVED(38, 47))
+ADNAV_PACKET_DECODER(gnss_configuration_packet_t)
+ADNAV_PACKET_ENCODER(gnss_configuration_packet_t)
+ADNAV_PACKET_TRAITS(user_data_packet_t, packet_id_user_data, 64)
+ADNAV_PACKET_LAYOUT(user_data_packet_t,
+    ADNAV_ARRAY(user_data, 0, uint8_t, 64))
+ADNAV_PACKET_DECODER(user_data_packet_t)
+ADNAV_PACKET_ENCODER(user_data_packet_t)
+ADNAV_PACKET_TRAITS(gpio_input_configuration_packet_t, packet_id_gpio_input_configuration, 65)
+ADNAV_PACKET_LAYOUT(gpio_input_configuration_packet_t,
+    ADNAV_FIELD(permanent, 0, uint8_t),
+    ADNAV_FIELD(gimbal_radians_per_encoder_tick, 1, float),
+    ADNAV_RESERVED(5, 60))
+ADNAV_PACKET_DECODER(gpio_input_configuration_packet_t)
+ADNAV_PACKET_ENCODER(gpio_input_configuration_packet_t)
+ADNAV_PACKET_TRAITS(ip_dataports_configuration_packet_t, packet_id_ip_dataports_configuration, 30)
+ADNAV_PACKET_LAYOUT(ip_dataports_configuration_packet_t,
+    ADNAV_RESERVED(0, 2),
+    ADNAV_FIELD(ip_dataport_configuration[0].ip_address, 2, uint32_t),
+    ADNAV_FIELD(ip_dataport_configuration[0].port, 6, uint16_t),
+    ADNAV_FIELD(ip_dataport_configuration[0].ip_dataport_mode, 8, uint8_t),
+    ADNAV_FIELD(ip_dataport_configuration[1].ip_address, 9, uint32_t),
+    ADNAV_FIELD(ip_dataport_configuration[1].port, 13, uint16_t),
+    ADNAV_FIELD(ip_dataport_configuration[1].ip_dataport_mode, 15, uint8_t),
+    ADNAV_FIELD(ip_dataport_configuration[2].ip_address, 16, uint32_t),
+    ADNAV_FIELD(ip_dataport_configuration[2].port, 20, uint16_t),
+    ADNAV_FIELD(ip_dataport_configuration[2].ip_dataport_mode, 22, uint8_t),
+    ADNAV_FIELD(ip_dataport_configuration[3].ip_address, 23, uint32_t),
+    ADNAV_FIELD(ip_dataport_configuration[3].port, 27, uint16_t),
+    ADNAV_FIELD(ip_dataport_configuration[3].ip_dataport_mode, 29, uint8_t))
+ADNAV_PACKET_DECODER(ip_dataports_configuration_packet_t)
+ADNAV_PACKET_ENCODER(ip_dataports_configuration_packet_t)
+ADNAV_PACKET_TRAITS(can_configuration_packet_t, packet_id_can_configuration, 11)
+ADNAV_PACKET_LAYOUT(can_configuration_packet_t,
+    ADNAV_FIELD(permanent, 0, uint8_t),
+    ADNAV_FIELD(enabled, 1, uint8_t),
+    ADNAV_FIELD(baud_rate, 2, uint32_t),
+    ADNAV_FIELD(can_protocol, 6, uint8_t),
+    ADNAV_RESERVED(7, 4))
+ADNAV_PACKET_DECODER(can_configuration_packet_t)
+ADNAV_PACKET_ENCODER(can_configuration_packet_t)
+ADNAV_PACKET_TRAITS(zero_angular_velocity_packet_t, packet_id_zero_angular_velocity, 8)
+ADNAV_PACKET_LAYOUT(zero_angular_velocity_packet_t,
+    ADNAV_FIELD(duration, 0, float),
+    ADNAV_RESERVED(4, 4))
+ADNAV_PACKET_ENCODER(zero_angular_velocity_packet_t)
+ADNAV_PACKET_TRAITS(zero_alignment_packet_t, packet_id_zero_alignment, 5)
+ADNAV_PACKET_LAYOUT(zero_alignment_packet_t,
+    ADNAV_FIELD(permanent, 0, uint8_t),
+    ADNAV_CONSTANT(1, uint32_t, 0x9A4E8055))
+ADNAV_PACKET_ENCODER(zero_alignment_packet_t)
+
+#undef ADNAV_PACKET_TRAITS
+#undef ADNAV_MEMBER_SIZE
+#undef ADNAV_FIELD
+#undef ADNAV_ARRAY
+#undef ADNAV_FLAG
+#undef ADNAV_RESERVED
+#undef ADNAV_RESERVED_FIELD
+#undef ADNAV_STRING
+#undef ADNAV_CONSTANT
+#undef ADNAV_PACKET_LAYOUT
+#undef ADNAV_PACKET_DECODER
+#undef ADNAV_PACKET_ENCODER
+#undef ADNAV_PACKET_C_DECODER
+#undef ADNAV_PACKET_C_ENCODER
+
+/**
+ * @brief Decode a packet view into a packet structure.
+ *
+ * @param an_packet_view View of a decoded packet, see an_packet_decode_view().
+ * @param packet Structure to decode into.
+ * @return true if the id and length matched and the packet was decoded.
+*/
+template <typename T>
+inline bool decode(const an_packet_view_t& an_packet_view, T& packet) {
+    return packet_decoder<T>::decode(&packet, &an_packet_view) == 0;
+}
+
+/**
+ * @brief Encode a packet structure, including header LRC and CRC, into a buffer.
+ *
+ * @param packet Structure to encode.
+ * @param buffer Destination buffer.
+ * @param capacity Size of the destination buffer in bytes.
+ * @return Number of bytes written, 0 if the buffer was too small.
+*/
+template <typename T>
+inline int encode(const T& packet, uint8_t* buffer, size_t capacity) {
+    return packet_encoder<T>::encode(buffer, capacity, packet);
+}
+
+/**
+ * @brief Encode a packet structure into a fixed size array.
+*/
+template <typename T, size_t N>
+inline int encode(const T& packet, uint8_t (&buffer)[N]) {
+    static_assert(N >= packet_traits<T>::max_frame_size, "Buffer is too small for this packet type");
+    return packet_encoder<T>::encode(buffer, N, packet);
+}
+
+} // namespace adnav
+
+#endif // ADNAV_PACKET_TRAITS_H_
@@ -0,0 +1,148 @@
+/****************************************************************/
+/*                                                              */
+/*                     Advanced Navigation                      */
+/*                        Event Reactor                         */
+/*         Copyright 2023, Advanced Navigation Pty Ltd          */
+/*                                                              */
+/****************************************************************/
+/*
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef ADNAV_REACTOR_H_
+#define ADNAV_REACTOR_H_
+
+#include <stdint.h>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
+#include <unordered_map>
+
+#if defined(__linux__)
+    #include <sys/epoll.h>
+#endif
+
+namespace adnav {
+
+#if defined(__linux__)
+
+/**
+ * @brief Single threaded epoll event loop.
+ * File descriptors for serial ports, sockets or any other pollable source are
+ * registered with a callback that is invoked from the thread running the loop
+ * whenever the descriptor becomes ready. Registrations are level triggered, so
+ * a callback that does not drain its descriptor will be called again on the
+ * next iteration. add(), modify(), remove() and stop() may be called from any
+ * thread, including from within a callback. Once remove() returns the callback
+ * is not running and will not be called again, so its owner may be destroyed.
+*/
+class Reactor {
+    public:
+        typedef std::function<void(uint32_t events)> callback_t;
+
+        // Should not be clonable
+        Reactor(const Reactor&) = delete;
+
+        // Should not be assignable
+        Reactor& operator=(const Reactor&) = delete;
+
+        Reactor();
+        ~Reactor();
+
+        /**
+         * @brief Register a file descriptor with the reactor.
+         *
+         * @param fd File descriptor to watch. Must not already be registered.
+         * @param events epoll event mask, e.g. EPOLLIN.
+         * @param callback Invoked with the ready events.
+        */
+        void add(int fd, uint32_t events, callback_t callback);
+
+        /**
+         * @brief Change the event mask of a registered file descriptor.
+        */
+        void modify(int fd, uint32_t events);
+
+        /**
+         * @brief Unregister a file descriptor. Must be called before the
+         * descriptor is closed. Pending events for it are dropped.
+         * Called from another thread while the callback is running, waits
+         * for it to return, so the caller must not hold a lock the callback
+         * takes. Called from the reactor thread it returns straight away.
+        */
+        void remove(int fd);
+
+        /**
+         * @brief Wait for and dispatch a single batch of events.
+         *
+         * @param timeout_ms Maximum time to wait, -1 to wait indefinitely.
+         * @return Number of callbacks invoked, -1 on error.
+        */
+        int runOnce(int timeout_ms = -1);
+
+        /**
+         * @brief Dispatch events until stop() is called.
+        */
+        void run();
+
+        /**
+         * @brief Wake the loop and make run() return. Thread safe.
+        */
+        void stop();
+
+        bool isRunning() {return running_.load();}
+
+    private:
+        struct Registration {
+            int fd;
+            callback_t callback;
+        };
+
+        static constexpr int MAX_EVENTS = 32;
+
+        void wake();
+        void finishDispatch();
+
+        int epoll_fd_ = -1;
+        int wake_fd_ = -1;
+        std::atomic_bool running_ = {false};
+        std::atomic_bool stop_requested_ = {false};
+
+        // Registrations are keyed by a serial rather than the descriptor so
+        // that a descriptor removed and reused within one batch of events is
+        // not dispatched to the wrong callback.
+        std::mutex mutex_;
+        uint64_t next_serial_ = 1;
+        std::unordered_map<uint64_t, std::shared_ptr<Registration>> registrations_;
+        std::unordered_map<int, uint64_t> serials_;
+        // Registration whose callback is running, and the thread running it.
+        uint64_t dispatching_ = 0;
+        std::thread::id dispatch_thread_;
+        std::condition_variable dispatched_;
+};
+
+#endif // defined(__linux__)
+
+}// namespace adnav
+
+#endif // ADNAV_REACTOR_H_
@@ -0,0 +1,173 @@
+/****************************************************************/
+/*                                                              */
+/*                     Advanced Navigation                      */
+/*                      TCP Reconnector                         */
+/*         Copyright 2023, Advanced Navigation Pty Ltd          */
+/*                                                              */
+/****************************************************************/
+/*
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef ADNAV_RECONNECTOR_H_
+#define ADNAV_RECONNECTOR_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <functional>
+#include <mutex>
+#include <random>
+#include <string>
+
+#include "adnav_reactor.h"
+#include "an_packet_protocol.h"
+
+#if defined(__linux__)
+    #include <netinet/in.h>
+#endif
+
+namespace adnav {
+
+#if defined(__linux__)
+
+constexpr int RECONNECT_INITIAL_BACKOFF_MS = 100;
+constexpr int RECONNECT_MAX_BACKOFF_MS = 10000;
+constexpr int RECONNECT_CONNECT_TIMEOUT_MS = 2000;
+
+typedef enum {
+    LINK_DISCONNECTED,
+    LINK_CONNECTING,
+    LINK_CONNECTED
+}link_state_e;
+
+typedef struct {
+    uint64_t connect_attempts;
+    uint64_t connects;
+    uint64_t disconnects;
+    // Time spent without a connection, since start().
+    uint64_t outage_ms;
+    uint64_t bytes_received;
+    uint64_t packets_decoded;
+}reconnector_statistics_t;
+
+/**
+ * @brief TCP client that keeps itself connected in the background.
+ * Connections are made with a non-blocking connect() driven by the reactor,
+ * so neither start() nor a lost link ever blocks the caller. Failed attempts
+ * are retried after an exponentially growing delay, from initial_backoff_ms
+ * up to max_backoff_ms, randomised by up to half so that many clients do not
+ * retry in step. When the server closes the connection or a read fails the
+ * link is re-established the same way.
+ *
+ * The decoder is reset on every new connection so a packet cut short by the
+ * outage is never joined to the start of the next stream. Packets and link
+ * state changes are delivered on the reactor thread; a transition to
+ * LINK_CONNECTED reports how long the link was down.
+*/
+class TcpReconnector {
+    public:
+        typedef std::function<void(const an_packet_view_t& an_packet)> packet_handler_t;
+        typedef std::function<void(link_state_e state, uint64_t outage_ms)> state_handler_t;
+        // Bytes as received, with their receive time in nanoseconds since the Unix epoch.
+        typedef std::function<void(const uint8_t* data, size_t length, uint64_t timestamp)> data_handler_t;
+
+        // Should not be clonable
+        TcpReconnector(const TcpReconnector&) = delete;
+
+        // Should not be assignable
+        TcpReconnector& operator=(const TcpReconnector&) = delete;
+
+        /**
+         * @brief Constructor
+         * @param reactor Reactor driving the connection. Must outlive the reconnector.
+         * @param ip_address IPv4 address of the device.
+         * @param port TCP port of the device.
+        */
+        TcpReconnector(Reactor& reactor, const std::string& ip_address, int port,
+            int initial_backoff_ms = RECONNECT_INITIAL_BACKOFF_MS, int max_backoff_ms = RECONNECT_MAX_BACKOFF_MS);
+        ~TcpReconnector() {stop();}
+
+        // Handlers must be set before start(). Received data is only decoded
+        // when a packet handler is set.
+        void onPacket(packet_handler_t handler) {packet_handler_ = std::move(handler); decode_ = true;}
+        void onStateChange(state_handler_t handler) {state_handler_ = std::move(handler);}
+        void onData(data_handler_t handler) {data_handler_ = std::move(handler);}
+
+        /**
+         * @brief Begin connecting. Returns immediately.
+        */
+        void start();
+
+        /**
+         * @brief Close the connection and stop reconnecting.
+        */
+        void stop();
+
+        /**
+         * @brief Write to the device. Safe to call from any thread, including
+         * from within the handlers.
+         *
+         * @return Number of bytes written, -1 if not connected or on error.
+        */
+        int write(const void* buf, size_t len);
+
+        link_state_e state();
+        reconnector_statistics_t statistics();
+
+    private:
+        void onTimer();
+        void onSocket(uint32_t events);
+        void beginConnect();
+        void connected();
+        void attemptFailed();
+        void connectionLost();
+        void closeSocket();
+        void armTimer(int delay_ms);
+        int backoff();
+        void setState(link_state_e state, uint64_t outage_ms);
+
+        Reactor& reactor_;
+        struct sockaddr_in address_;
+        int initial_backoff_ms_;
+        int max_backoff_ms_;
+
+        // Handlers may call write(), so the lock is reentrant.
+        std::recursive_mutex mutex_;
+        int sock_ = -1;
+        int timer_fd_ = -1;
+        bool running_ = false;
+        link_state_e state_ = LINK_DISCONNECTED;
+        int attempt_ = 0;
+        uint64_t disconnected_at_ms_ = 0;
+        std::mt19937 random_;
+
+        an_decoder_t decoder_;
+        bool decode_ = false;
+        packet_handler_t packet_handler_ = [](const an_packet_view_t&) {};
+        state_handler_t state_handler_ = [](link_state_e, uint64_t) {};
+        data_handler_t data_handler_ = [](const uint8_t*, size_t, uint64_t) {};
+        reconnector_statistics_t statistics_;
+};
+
+#endif // defined(__linux__)
+
+}// namespace adnav
+
+#endif // ADNAV_RECONNECTOR_H_
@@ -0,0 +1,156 @@
+/****************************************************************/
+/*                                                              */
+/*                     Advanced Navigation                      */
+/*                    Serial Reconnector                        */
+/*         Copyright 2023, Advanced Navigation Pty Ltd          */
+/*                                                              */
+/****************************************************************/
+/*
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef ADNAV_SERIAL_RECONNECTOR_H_
+#define ADNAV_SERIAL_RECONNECTOR_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <functional>
+#include <mutex>
+#include <string>
+
+#include "rs232.h"
+#include "adnav_reactor.h"
+#include "adnav_reconnector.h"
+#include "an_packet_protocol.h"
+
+namespace adnav {
+
+#if defined(__linux__)
+
+constexpr int SERIAL_REOPEN_INTERVAL_MS = 1000;
+
+/**
+ * @brief Serial port that survives the device being unplugged.
+ * The port is identified by its /dev/serial/by-id link where there is one,
+ * so a USB adapter is found again even if it comes back as a different
+ * ttyUSB. Removal is detected from read errors and hang ups on the port.
+ * Reopening is attempted whenever a device node appears (inotify on /dev
+ * and /dev/serial/by-id) and every SERIAL_REOPEN_INTERVAL_MS as a fallback.
+ *
+ * As with TcpReconnector, the decoder is reset on every reopen, packets
+ * and link state changes are delivered on the reactor thread, and a
+ * transition to LINK_CONNECTED reports how long the device was gone.
+*/
+class SerialReconnector {
+    public:
+        typedef std::function<void(const an_packet_view_t& an_packet)> packet_handler_t;
+        typedef std::function<void(link_state_e state, uint64_t outage_ms)> state_handler_t;
+        // Bytes as read, with their receive time in nanoseconds since the Unix epoch.
+        typedef std::function<void(const uint8_t* data, size_t length, uint64_t timestamp)> data_handler_t;
+
+        // Should not be clonable
+        SerialReconnector(const SerialReconnector&) = delete;
+
+        // Should not be assignable
+        SerialReconnector& operator=(const SerialReconnector&) = delete;
+
+        /**
+         * @brief Constructor
+         * @param reactor Reactor servicing the port. Must outlive the reconnector.
+         * @param port Port name or path, e.g. ttyUSB0 or /dev/serial/by-id/...
+         * @param baud_rate Baud rate, see comOpen().
+         * @param low_latency Open with com_open_path_low_latency().
+        */
+        SerialReconnector(Reactor& reactor, const std::string& port, int baud_rate, bool low_latency = false);
+        ~SerialReconnector() {stop();}
+
+        // Handlers must be set before start(). Received data is only decoded
+        // when a packet handler is set.
+        void onPacket(packet_handler_t handler) {packet_handler_ = std::move(handler); decode_ = true;}
+        void onStateChange(state_handler_t handler) {state_handler_ = std::move(handler);}
+        void onData(data_handler_t handler) {data_handler_ = std::move(handler);}
+
+        /**
+         * @brief Open the port, or wait for it to appear. Returns immediately.
+        */
+        void start();
+
+        /**
+         * @brief Close the port and stop watching for it.
+        */
+        void stop();
+
+        /**
+         * @brief Write to the device. Safe to call from any thread, including
+         * from within the handlers. Short writes are resumed, waiting up to
+         * WRITE_TIMEOUT_MS at a time for the port to drain.
+         *
+         * @return Number of bytes written, which is less than len if the port
+         * stopped draining, -1 if the device is not present or the write failed.
+        */
+        int write(const void* buf, size_t len);
+
+        link_state_e state();
+        reconnector_statistics_t statistics();
+
+        // Path the port is opened by. Resolved when start() is called and
+        // again on every reopen, so a /dev/serial/by-id link that did not
+        // exist at first is adopted once the device has been seen.
+        std::string path();
+
+    private:
+        void onReadable(uint32_t events);
+        void onDeviceEvent();
+        void onTimer();
+        bool reopen();
+        void connectionLost();
+        void watchDevices();
+        void armTimer(bool enable);
+        void setState(link_state_e state, uint64_t outage_ms);
+
+        Reactor& reactor_;
+        std::string port_;
+        std::string path_;
+        int baud_rate_;
+        bool low_latency_;
+
+        // Handlers may call write(), so the lock is reentrant.
+        std::recursive_mutex mutex_;
+        com_handle_t* serial_ = nullptr;
+        int fd_ = -1;
+        int inotify_fd_ = -1;
+        int timer_fd_ = -1;
+        bool running_ = false;
+        link_state_e state_ = LINK_DISCONNECTED;
+        uint64_t disconnected_at_ms_ = 0;
+
+        an_decoder_t decoder_;
+        bool decode_ = false;
+        packet_handler_t packet_handler_ = [](const an_packet_view_t&) {};
+        state_handler_t state_handler_ = [](link_state_e, uint64_t) {};
+        data_handler_t data_handler_ = [](const uint8_t*, size_t, uint64_t) {};
+        reconnector_statistics_t statistics_;
+};
+
+#endif // defined(__linux__)
+
+}// namespace adnav
+
+#endif // ADNAV_SERIAL_RECONNECTOR_H_
@@ -0,0 +1,163 @@
+/****************************************************************/
+/*                                                              */
+/*                     Advanced Navigation                      */
+/*                       Stream Server                          */
+/*         Copyright 2023, Advanced Navigation Pty Ltd          */
+/*                                                              */
+/****************************************************************/
+/*
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef ADNAV_STREAM_SERVER_H_
+#define ADNAV_STREAM_SERVER_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "adnav_reactor.h"
+
+namespace adnav {
+
+#if defined(__linux__)
+
+constexpr size_t STREAM_CLIENT_BACKLOG = 256 * 1024;
+constexpr int STREAM_SERVER_WRITE_VECTORS = 64;
+
+// What to do with a client that has more than its backlog waiting.
+typedef enum {
+    SLOW_CLIENT_DISCONNECT,
+    SLOW_CLIENT_SKIP
+}slow_client_policy_e;
+
+// Broadcast data, shared by every client it is queued for.
+typedef std::shared_ptr<const std::vector<uint8_t>> stream_chunk_t;
+
+typedef struct {
+    uint64_t clients_accepted;
+    // Clients disconnected by the slow client policy, or on error.
+    uint64_t clients_dropped;
+    uint64_t chunks_broadcast;
+    uint64_t bytes_broadcast;
+    // Chunks not sent to a slow client under SLOW_CLIENT_SKIP.
+    uint64_t chunks_skipped;
+    size_t clients;
+}stream_server_statistics_t;
+
+/**
+ * @brief TCP server that fans the device stream out to any number of clients.
+ * Clients may connect and disconnect at any time; connections are accepted
+ * by the reactor so neither open() nor broadcast() waits for them. Each
+ * broadcast chunk is stored once and referenced by every client queue, and
+ * is written straight away to clients that are keeping up. A client with
+ * more than client_backlog bytes waiting is either disconnected or has new
+ * chunks skipped until it catches up, so one slow client never stalls the
+ * others or the caller. Data sent by clients is discarded.
+*/
+class StreamServer {
+    public:
+        // Should not be clonable
+        StreamServer(const StreamServer&) = delete;
+
+        // Should not be assignable
+        StreamServer& operator=(const StreamServer&) = delete;
+
+        /**
+         * @brief Constructor
+         * @param reactor Reactor accepting and servicing clients. Must outlive the server.
+         * @param port TCP port to listen on, on all interfaces.
+         * @param client_backlog Bytes allowed to wait for a single client.
+         * @param policy Handling of clients over their backlog.
+        */
+        StreamServer(Reactor& reactor, int port, size_t client_backlog = STREAM_CLIENT_BACKLOG,
+            slow_client_policy_e policy = SLOW_CLIENT_DISCONNECT);
+        ~StreamServer() {close();}
+
+        /**
+         * @brief Start listening. Returns immediately, clients are accepted
+         * by the reactor as they connect.
+        */
+        void open();
+
+        /**
+         * @brief Stop listening and disconnect every client.
+        */
+        void close();
+
+        bool isOpen() {return listen_fd_ >= 0;}
+
+        /**
+         * @brief Send data to every connected client. Thread safe.
+         * The data is copied once into a shared chunk.
+        */
+        void broadcast(const void* buf, size_t len);
+
+        /**
+         * @brief Send a chunk to every connected client without copying it.
+        */
+        void broadcast(stream_chunk_t chunk);
+
+        size_t clientCount();
+
+        stream_server_statistics_t statistics();
+
+    private:
+        struct Client {
+            int fd;
+            std::deque<stream_chunk_t> pending;
+            // Bytes of the front chunk already sent.
+            size_t offset;
+            size_t pending_bytes;
+            bool writable_wait;
+        };
+
+        void acceptClients();
+        void service(uint64_t id, uint32_t events);
+        bool flush(Client& client);
+        // Forget a client, returning its descriptor for disconnect(). Off the
+        // reactor thread disconnect() must be called without mutex_ held, as
+        // remove() waits for the client's callback, which takes it.
+        int drop(uint64_t id, bool slow);
+        void disconnect(int fd);
+
+        Reactor& reactor_;
+        int port_;
+        size_t client_backlog_;
+        slow_client_policy_e policy_;
+        int listen_fd_ = -1;
+
+        // Clients are keyed by a serial so that a reactor callback for a
+        // dropped client cannot reach a new client given the same descriptor.
+        std::mutex mutex_;
+        uint64_t next_id_ = 1;
+        std::unordered_map<uint64_t, std::unique_ptr<Client>> clients_;
+        stream_server_statistics_t statistics_;
+};
+
+#endif // defined(__linux__)
+
+}// namespace adnav
+
+#endif // ADNAV_STREAM_SERVER_H_
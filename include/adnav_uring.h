@@ -0,0 +1,142 @@
+/****************************************************************/
+/*                                                              */
+/*                     Advanced Navigation                      */
+/*                     io_uring Receiver                        */
+/*         Copyright 2023, Advanced Navigation Pty Ltd          */
+/*                                                              */
+/****************************************************************/
+/*
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef ADNAV_URING_H_
+#define ADNAV_URING_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <functional>
+
+// The io_uring receiver needs multishot receives and provided buffer rings,
+// available from Linux 6.0 headers. Without them only the POSIX path is built.
+#if defined(__linux__) && defined(__has_include)
+    #if __has_include(<linux/io_uring.h>)
+        #include <linux/io_uring.h>
+        #if defined(IORING_RECV_MULTISHOT)
+            #define ADNAV_HAS_IO_URING 1
+        #endif
+    #endif
+#endif
+
+namespace adnav {
+
+#if defined(ADNAV_HAS_IO_URING)
+
+constexpr unsigned URING_BUFFER_COUNT = 64;
+constexpr unsigned URING_BUFFER_SIZE = 4096;
+
+/**
+ * @brief Stream socket receiver built on io_uring.
+ * A single multishot receive is kept posted against a ring of provided
+ * buffers, so the kernel fills buffers as data arrives without a system call
+ * per read. Completed buffers are handed to the caller and returned to the
+ * kernel as soon as the callback returns. Talks to the kernel directly and
+ * does not depend on liburing.
+*/
+class UringReceiver {
+    public:
+        typedef std::function<void(const uint8_t* data, size_t length)> data_callback_t;
+
+        // Should not be clonable
+        UringReceiver(const UringReceiver&) = delete;
+
+        // Should not be assignable
+        UringReceiver& operator=(const UringReceiver&) = delete;
+
+        /**
+         * @brief Constructor
+         * @param fd Connected stream socket to receive from.
+         * @param buffer_count Number of provided buffers, a power of two.
+         * @param buffer_size Size of each provided buffer in bytes.
+        */
+        UringReceiver(int fd, unsigned buffer_count = URING_BUFFER_COUNT, unsigned buffer_size = URING_BUFFER_SIZE)
+            : fd_(fd), buffer_count_(buffer_count), buffer_size_(buffer_size) {}
+        ~UringReceiver() {destroy();}
+
+        /**
+         * @brief Set up the ring and post the receive.
+         * @return false if io_uring or the required features are unavailable,
+         * in which case the caller should use the POSIX path.
+        */
+        bool init();
+
+        /**
+         * @brief Wait for received data and pass every completed buffer to the callback.
+         * Blocks until data arrives, the peer closes the connection or an error occurs.
+         * @return Number of bytes received, 0 if the peer closed the connection,
+         * or a negative errno on error.
+        */
+        int wait(const data_callback_t& callback);
+
+        bool isReady() {return ring_fd_ >= 0;}
+
+    private:
+        void destroy();
+        bool postReceive();
+        void recycleBuffer(uint16_t id);
+
+        int fd_;
+        unsigned buffer_count_;
+        unsigned buffer_size_;
+        int ring_fd_ = -1;
+        bool closed_ = false;
+
+        // Submission queue
+        void* sq_ring_ = nullptr;
+        size_t sq_ring_size_ = 0;
+        struct io_uring_sqe* sqes_ = nullptr;
+        size_t sqes_size_ = 0;
+        unsigned* sq_head_ = nullptr;
+        unsigned* sq_tail_ = nullptr;
+        unsigned* sq_mask_ = nullptr;
+        unsigned* sq_array_ = nullptr;
+
+        // Completion queue, which may share the submission queue mapping.
+        void* cq_ring_ = nullptr;
+        size_t cq_ring_size_ = 0;
+        unsigned* cq_head_ = nullptr;
+        unsigned* cq_tail_ = nullptr;
+        unsigned* cq_mask_ = nullptr;
+        struct io_uring_cqe* cqes_ = nullptr;
+
+        // Provided buffer ring and the buffers it hands out. The ring is
+        // addressed as an array of io_uring_buf because the flexible array in
+        // io_uring_buf_ring is not laid out as in C when compiled as C++. The
+        // ring tail overlays the resv field of the first entry.
+        struct io_uring_buf* buffer_ring_ = nullptr;
+        size_t buffer_ring_size_ = 0;
+        uint8_t* buffers_ = nullptr;
+        bool buffers_registered_ = false;
+};
+
+#endif // defined(ADNAV_HAS_IO_URING)
+
+}// namespace adnav
+
+#endif // ADNAV_URING_H_
@@ -0,0 +1,138 @@
+/****************************************************************/
+/*                                                              */
+/*                     Advanced Navigation                      */
+/*                        Write Queue                           */
+/*         Copyright 2023, Advanced Navigation Pty Ltd          */
+/*                                                              */
+/****************************************************************/
+/*
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef ADNAV_WRITE_QUEUE_H_
+#define ADNAV_WRITE_QUEUE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "adnav_comms.h"
+
+namespace adnav {
+
+#if defined(__linux__)
+
+constexpr size_t WRITE_QUEUE_CAPACITY = 64 * 1024;
+constexpr int WRITE_QUEUE_BATCH = 64;
+
+typedef struct {
+    uint64_t packets_queued;
+    uint64_t bytes_queued;
+    uint64_t packets_written;
+    uint64_t bytes_written;
+    // Number of writev or sendmmsg calls used to write them.
+    uint64_t batches;
+    // Packets rejected because the queue was full.
+    uint64_t packets_dropped;
+    // Batches that could not be written in full, their unwritten packets are discarded.
+    uint64_t write_errors;
+    // Writes resumed after a short write, and waits for the device to drain.
+    uint64_t partial_writes;
+    uint64_t write_stalls;
+    // Bytes waiting to be written now, and the most ever waiting.
+    size_t queued_bytes;
+    size_t high_water_bytes;
+}write_queue_statistics_t;
+
+/**
+ * @brief Asynchronous outbound queue for a Communicator.
+ * Encoded packets are copied in by push() from any thread and written by a
+ * dedicated thread, which gathers everything waiting into a single
+ * writeBatch() call. Short writes are resumed and a full device is waited
+ * on by the writer thread alone, and a packet that has started going out is
+ * given extra time to finish rather than being truncated. When
+ * more than capacity bytes are waiting new packets are rejected, which is
+ * reported by push() and counted in the statistics.
+*/
+class WriteQueue {
+    public:
+        // Should not be clonable
+        WriteQueue(const WriteQueue&) = delete;
+
+        // Should not be assignable
+        WriteQueue& operator=(const WriteQueue&) = delete;
+
+        /**
+         * @brief Constructor, starts the writer thread.
+         * @param communicator Open connection to write to. Must outlive the queue.
+         * @param capacity Maximum number of bytes waiting to be written.
+        */
+        explicit WriteQueue(Communicator& communicator, size_t capacity = WRITE_QUEUE_CAPACITY);
+
+        // Writes out anything still queued before returning.
+        ~WriteQueue();
+
+        /**
+         * @brief Queue an encoded packet, or any other buffer, for writing.
+         * @return false if the queue is full and the buffer was dropped.
+        */
+        bool push(const void* buf, size_t len);
+
+        /**
+         * @brief Queue an an_packet_t, which remains owned by the caller.
+        */
+        bool push(an_packet_t* an_packet) {return push(an_packet_pointer(an_packet), an_packet_size(an_packet));}
+
+        /**
+         * @brief Block until everything queued so far has been written.
+        */
+        void flush();
+
+        write_queue_statistics_t statistics();
+
+    private:
+        void writer();
+
+        Communicator& communicator_;
+        size_t capacity_;
+
+        std::mutex mutex_;
+        std::condition_variable queued_;
+        std::condition_variable drained_;
+        std::deque<std::vector<uint8_t>> queue_;
+        // Buffers taken from the queue and being written, kept for reuse.
+        std::vector<std::vector<uint8_t>> writing_;
+        std::vector<std::vector<uint8_t>> spare_;
+        bool stop_ = false;
+        bool busy_ = false;
+
+        write_queue_statistics_t statistics_;
+        std::thread thread_;
+};
+
+#endif // defined(__linux__)
+
+}// namespace adnav
+
+#endif // ADNAV_WRITE_QUEUE_H_
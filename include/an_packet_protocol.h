@@ -50,11 +50,41 @@ extern "C"
 #define an_decoder_size(an_decoder) (sizeof((an_decoder)->buffer) - (an_decoder)->buffer_length)
 #define an_decoder_increment(an_decoder, bytes_received) (an_decoder)->buffer_length += bytes_received
 
+#ifndef AN_RING_DECODE_BUFFER_SIZE
+#define AN_RING_DECODE_BUFFER_SIZE 4096
+#endif
+#if (AN_RING_DECODE_BUFFER_SIZE & (AN_RING_DECODE_BUFFER_SIZE - 1)) != 0
+#error "AN_RING_DECODE_BUFFER_SIZE must be a power of two"
+#endif
+
+#ifndef AN_DECODER_TIMESTAMP_COUNT
+#define AN_DECODER_TIMESTAMP_COUNT 16
+#endif
+#define AN_RING_DECODE_BUFFER_MASK (AN_RING_DECODE_BUFFER_SIZE - 1)
+
+#define an_ring_decoder_pointer(an_ring_decoder) &(an_ring_decoder)->buffer[(an_ring_decoder)->head & AN_RING_DECODE_BUFFER_MASK]
+#define an_ring_decoder_free(an_ring_decoder) (AN_RING_DECODE_BUFFER_SIZE - ((an_ring_decoder)->head - (an_ring_decoder)->tail))
+#define an_ring_decoder_contiguous(an_ring_decoder) (AN_RING_DECODE_BUFFER_SIZE - ((an_ring_decoder)->head & AN_RING_DECODE_BUFFER_MASK))
+#define an_ring_decoder_size(an_ring_decoder) (an_ring_decoder_free(an_ring_decoder) < an_ring_decoder_contiguous(an_ring_decoder) ? an_ring_decoder_free(an_ring_decoder) : an_ring_decoder_contiguous(an_ring_decoder))
+#define an_ring_decoder_increment(an_ring_decoder, bytes_received) (an_ring_decoder)->head += bytes_received
+
+#define AN_PACKET_POOL_SLAB_SIZE ((sizeof(an_packet_t) + AN_MAXIMUM_PACKET_SIZE + 7) & ~((size_t) 7))
+
 #ifndef FALSE
 #define FALSE 0
 #define TRUE 1
 #endif
 
+/*
+ * Host receive time of the bytes appended to a decoder from offset onwards,
+ * recorded by an_decoder_mark_timestamp() and an_ring_decoder_mark_timestamp()
+ */
+typedef struct
+{
+	uint32_t offset;
+	uint64_t timestamp;
+} an_decoder_timestamp_t;
+
 typedef struct
 {
 	uint8_t buffer[AN_DECODE_BUFFER_SIZE];
@@ -64,8 +94,15 @@ typedef struct
 	uint64_t bytes_discarded;
 	uint64_t lrc_errors;
 	uint64_t crc_errors;
+	uint16_t view_length;
+	an_decoder_timestamp_t timestamps[AN_DECODER_TIMESTAMP_COUNT];
+	uint8_t timestamp_count;
 } an_decoder_t;
 
+/*
+ * The header and data are written out as one contiguous frame, so nothing can
+ * be placed between them. Receive times are carried by an_packet_view_t.
+ */
 typedef struct
 {
 	uint8_t id;
@@ -74,6 +111,65 @@ typedef struct
 	uint8_t data[1];
 } an_packet_t;
 
+/*
+ * Borrowed packet returned by an_packet_decode_view() and
+ * an_packet_decode_batch(). The header and data pointers reference the
+ * decoder buffer and are only valid until the next decode call on that
+ * decoder, or until the batch callback returns. timestamp is the host
+ * receive time of the first byte of the packet, or 0 if no timestamp was
+ * recorded for it.
+ */
+typedef struct
+{
+	uint8_t id;
+	uint8_t length;
+	uint8_t* header;
+	uint8_t* data;
+	uint64_t timestamp;
+} an_packet_view_t;
+
+typedef void (*an_packet_view_callback_t)(an_packet_view_t* an_packet_view, void* context);
+
+/*
+ * Decoder state backed by a power of two circular buffer. head and tail are
+ * free running indices that are masked on access, so decoded bytes are
+ * released by advancing tail rather than moving the remaining data. Packets
+ * that wrap around the end of the buffer are copied into packet when a
+ * contiguous view is required.
+ */
+typedef struct
+{
+	uint8_t buffer[AN_RING_DECODE_BUFFER_SIZE];
+	uint8_t packet[AN_PACKET_HEADER_SIZE + AN_MAXIMUM_PACKET_SIZE];
+	uint32_t head;
+	uint32_t tail;
+	uint64_t packets_decoded;
+	uint64_t bytes_decoded;
+	uint64_t bytes_discarded;
+	uint64_t lrc_errors;
+	uint64_t crc_errors;
+	uint16_t view_length;
+	an_decoder_timestamp_t timestamps[AN_DECODER_TIMESTAMP_COUNT];
+	uint8_t timestamp_count;
+} an_ring_decoder_t;
+
+/*
+ * Fixed size packet pool. Every slab can hold an an_packet_t with a payload
+ * of AN_MAXIMUM_PACKET_SIZE, and free slabs are kept on a lock free list so
+ * packets can be allocated and freed from any thread. When the pool is
+ * exhausted allocations fall back to malloc.
+ */
+typedef struct an_packet_pool_s an_packet_pool_t;
+
+typedef struct
+{
+	uint32_t slab_count;
+	uint32_t in_use;
+	uint32_t high_water_mark;
+	uint64_t allocations;
+	uint64_t fallback_allocations;
+} an_packet_pool_statistics_t;
+
 static const uint16_t crc16_table[256] =
 	{
 		0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50a5, 0x60c6, 0x70e7, 0x8108, 0x9129, 0xa14a, 0xb16b, 0xc18c, 0xd1ad, 0xe1ce, 0xf1ef, 0x1231, 0x0210, 0x3273,
@@ -92,8 +188,24 @@ static const uint16_t crc16_table[256] =
 an_packet_t* an_packet_allocate(uint8_t length, uint8_t id);
 void an_packet_free(an_packet_t** an_packet);
 void an_decoder_initialise(an_decoder_t* an_decoder);
+void an_decoder_mark_timestamp(an_decoder_t* an_decoder, uint64_t timestamp);
 an_packet_t* an_packet_decode(an_decoder_t* an_decoder);
+int an_packet_decode_view(an_decoder_t* an_decoder, an_packet_view_t* an_packet_view);
+int an_packet_decode_batch(an_decoder_t* an_decoder, an_packet_view_callback_t callback, void* context, int maximum_packets);
+void an_packet_get_view(an_packet_t* an_packet, an_packet_view_t* an_packet_view);
+void an_ring_decoder_initialise(an_ring_decoder_t* an_ring_decoder);
+void an_ring_decoder_mark_timestamp(an_ring_decoder_t* an_ring_decoder, uint64_t timestamp);
+an_packet_t* an_ring_packet_decode(an_ring_decoder_t* an_ring_decoder);
+int an_ring_packet_decode_view(an_ring_decoder_t* an_ring_decoder, an_packet_view_t* an_packet_view);
 void an_packet_encode(an_packet_t* an_packet);
+int an_packet_view_initialise(an_packet_view_t* an_packet_view, uint8_t* buffer, size_t capacity, size_t length, uint8_t id);
+void an_packet_view_encode(an_packet_view_t* an_packet_view);
+an_packet_pool_t* an_packet_pool_create(uint32_t slab_count);
+void an_packet_pool_destroy(an_packet_pool_t** an_packet_pool);
+void an_packet_pool_install(an_packet_pool_t* an_packet_pool);
+an_packet_t* an_packet_pool_allocate(an_packet_pool_t* an_packet_pool, uint8_t length, uint8_t id);
+void an_packet_pool_free(an_packet_pool_t* an_packet_pool, an_packet_t** an_packet);
+void an_packet_pool_get_statistics(an_packet_pool_t* an_packet_pool, an_packet_pool_statistics_t* statistics);
 
 #ifdef __cplusplus
 }
@@ -1379,110 +1379,219 @@ typedef struct
 
 
 int decode_acknowledge_packet(acknowledge_packet_t* acknowledge_packet, an_packet_t* an_packet);
+int decode_acknowledge_packet_view(acknowledge_packet_t* acknowledge_packet, const an_packet_view_t* an_packet);
 an_packet_t* encode_request_packet(uint8_t requested_packet_id);
+int encode_request_packet_into(uint8_t* buffer, size_t capacity, uint8_t requested_packet_id);
 int decode_boot_mode_packet(boot_mode_packet_t* boot_mode_packet, an_packet_t* an_packet);
+int decode_boot_mode_packet_view(boot_mode_packet_t* boot_mode_packet, const an_packet_view_t* an_packet);
 an_packet_t* encode_boot_mode_packet(boot_mode_packet_t* boot_mode_packet);
+int encode_boot_mode_packet_into(uint8_t* buffer, size_t capacity, boot_mode_packet_t* boot_mode_packet);
 int decode_device_information_packet(device_information_packet_t* device_information_packet, an_packet_t* an_packet);
+int decode_device_information_packet_view(device_information_packet_t* device_information_packet, const an_packet_view_t* an_packet);
 an_packet_t* encode_restore_factory_settings_packet();
+int encode_restore_factory_settings_packet_into(uint8_t* buffer, size_t capacity);
 an_packet_t* encode_reset_packet();
+int encode_reset_packet_into(uint8_t* buffer, size_t capacity);
 an_packet_t* encode_file_transfer_request_packet(file_transfer_first_packet_t* file_transfer_first_packet, int metadata_size, int data_size);
+int encode_file_transfer_request_packet_into(uint8_t* buffer, size_t capacity, file_transfer_first_packet_t* file_transfer_first_packet, int metadata_size, int data_size);
 int decode_file_transfer_acknowledge_packet(file_transfer_acknowledge_packet_t* file_transfer_acknowledge_packet, an_packet_t* an_packet);
+int decode_file_transfer_acknowledge_packet_view(file_transfer_acknowledge_packet_t* file_transfer_acknowledge_packet, const an_packet_view_t* an_packet);
 an_packet_t* encode_file_transfer_packet(file_transfer_ongoing_packet_t* file_transfer_ongoing_packet, int data_size);
+int encode_file_transfer_packet_into(uint8_t* buffer, size_t capacity, file_transfer_ongoing_packet_t* file_transfer_ongoing_packet, int data_size);
 int decode_serial_port_passthrough_packet(serial_port_passthrough_packet_t* serial_port_passthrough_packet, an_packet_t* an_packet);
+int decode_serial_port_passthrough_packet_view(serial_port_passthrough_packet_t* serial_port_passthrough_packet, const an_packet_view_t* an_packet);
 an_packet_t* encode_serial_port_passthrough_packet(serial_port_passthrough_packet_t* serial_port_passthrough_packet, int data_size);
+int encode_serial_port_passthrough_packet_into(uint8_t* buffer, size_t capacity, serial_port_passthrough_packet_t* serial_port_passthrough_packet, int data_size);
 int decode_ip_configuration_packet(ip_configuration_packet_t* ip_configuration_packet, an_packet_t* an_packet);
+int decode_ip_configuration_packet_view(ip_configuration_packet_t* ip_configuration_packet, const an_packet_view_t* an_packet);
 an_packet_t* encode_ip_configuration_packet(ip_configuration_packet_t* ip_configuration_packet);
+int encode_ip_configuration_packet_into(uint8_t* buffer, size_t capacity, ip_configuration_packet_t* ip_configuration_packet);
 int decode_subcomponent_information_packet(subcomponent_information_packet_t* subcomponent_information_packet, an_packet_t* an_packet);
+int decode_subcomponent_information_packet_view(subcomponent_information_packet_t* subcomponent_information_packet, const an_packet_view_t* an_packet);
 int decode_system_state_packet(system_state_packet_t* system_state_packet, an_packet_t* an_packet);
+int decode_system_state_packet_view(system_state_packet_t* system_state_packet, const an_packet_view_t* an_packet);
 int decode_unix_time_packet(unix_time_packet_t* unix_time_packet, an_packet_t* an_packet);
+int decode_unix_time_packet_view(unix_time_packet_t* unix_time_packet, const an_packet_view_t* an_packet);
 int decode_formatted_time_packet(formatted_time_packet_t* formatted_time_packet, an_packet_t* an_packet);
+int decode_formatted_time_packet_view(formatted_time_packet_t* formatted_time_packet, const an_packet_view_t* an_packet);
 int decode_status_packet(status_packet_t* status_packet, an_packet_t* an_packet);
+int decode_status_packet_view(status_packet_t* status_packet, const an_packet_view_t* an_packet);
 int decode_position_standard_deviation_packet(position_standard_deviation_packet_t* position_standard_deviation_packet, an_packet_t* an_packet);
+int decode_position_standard_deviation_packet_view(position_standard_deviation_packet_t* position_standard_deviation_packet, const an_packet_view_t* an_packet);
 int decode_velocity_standard_deviation_packet(velocity_standard_deviation_packet_t* velocity_standard_deviation_packet, an_packet_t* an_packet);
+int decode_velocity_standard_deviation_packet_view(velocity_standard_deviation_packet_t* velocity_standard_deviation_packet, const an_packet_view_t* an_packet);
 int decode_euler_orientation_standard_deviation_packet(euler_orientation_standard_deviation_packet_t* euler_orientation_standard_deviation, an_packet_t* an_packet);
+int decode_euler_orientation_standard_deviation_packet_view(euler_orientation_standard_deviation_packet_t* euler_orientation_standard_deviation, const an_packet_view_t* an_packet);
 int decode_quaternion_orientation_standard_deviation_packet(quaternion_orientation_standard_deviation_packet_t* quaternion_orientation_standard_deviation_packet, an_packet_t* an_packet);
+int decode_quaternion_orientation_standard_deviation_packet_view(quaternion_orientation_standard_deviation_packet_t* quaternion_orientation_standard_deviation_packet, const an_packet_view_t* an_packet);
 int decode_raw_sensors_packet(raw_sensors_packet_t* raw_sensors_packet, an_packet_t* an_packet);
+int decode_raw_sensors_packet_view(raw_sensors_packet_t* raw_sensors_packet, const an_packet_view_t* an_packet);
 int decode_raw_gnss_packet(raw_gnss_packet_t* raw_gnss_packet, an_packet_t* an_packet);
+int decode_raw_gnss_packet_view(raw_gnss_packet_t* raw_gnss_packet, const an_packet_view_t* an_packet);
 an_packet_t* encode_raw_gnss_packet(raw_gnss_packet_t* raw_gnss_packet);
+int encode_raw_gnss_packet_into(uint8_t* buffer, size_t capacity, raw_gnss_packet_t* raw_gnss_packet);
 int decode_satellites_packet(satellites_packet_t* satellites_packet, an_packet_t* an_packet);
+int decode_satellites_packet_view(satellites_packet_t* satellites_packet, const an_packet_view_t* an_packet);
 int decode_geodetic_position_packet(geodetic_position_packet_t* geodetic_position_packet, an_packet_t* an_packet);
+int decode_geodetic_position_packet_view(geodetic_position_packet_t* geodetic_position_packet, const an_packet_view_t* an_packet);
 int decode_ecef_position_packet(ecef_position_packet_t* ecef_position_packet, an_packet_t* an_packet);
+int decode_ecef_position_packet_view(ecef_position_packet_t* ecef_position_packet, const an_packet_view_t* an_packet);
 int decode_utm_position_packet(utm_position_packet_t* utm_position_packet, an_packet_t* an_packet);
+int decode_utm_position_packet_view(utm_position_packet_t* utm_position_packet, const an_packet_view_t* an_packet);
 int decode_ned_velocity_packet(ned_velocity_packet_t* ned_velocity_packet, an_packet_t* an_packet);
+int decode_ned_velocity_packet_view(ned_velocity_packet_t* ned_velocity_packet, const an_packet_view_t* an_packet);
 int decode_body_velocity_packet(body_velocity_packet_t* body_velocity_packet, an_packet_t* an_packet);
+int decode_body_velocity_packet_view(body_velocity_packet_t* body_velocity_packet, const an_packet_view_t* an_packet);
 int decode_acceleration_packet(acceleration_packet_t* acceleration, an_packet_t* an_packet);
+int decode_acceleration_packet_view(acceleration_packet_t* acceleration, const an_packet_view_t* an_packet);
 int decode_body_acceleration_packet(body_acceleration_packet_t* body_acceleration, an_packet_t* an_packet);
+int decode_body_acceleration_packet_view(body_acceleration_packet_t* body_acceleration, const an_packet_view_t* an_packet);
 int decode_euler_orientation_packet(euler_orientation_packet_t* euler_orientation_packet, an_packet_t* an_packet);
+int decode_euler_orientation_packet_view(euler_orientation_packet_t* euler_orientation_packet, const an_packet_view_t* an_packet);
 int decode_quaternion_orientation_packet(quaternion_orientation_packet_t* quaternion_orientation_packet, an_packet_t* an_packet);
+int decode_quaternion_orientation_packet_view(quaternion_orientation_packet_t* quaternion_orientation_packet, const an_packet_view_t* an_packet);
 int decode_dcm_orientation_packet(dcm_orientation_packet_t* dcm_orientation_packet, an_packet_t* an_packet);
+int decode_dcm_orientation_packet_view(dcm_orientation_packet_t* dcm_orientation_packet, const an_packet_view_t* an_packet);
 int decode_angular_velocity_packet(angular_velocity_packet_t* angular_velocity_packet, an_packet_t* an_packet);
+int decode_angular_velocity_packet_view(angular_velocity_packet_t* angular_velocity_packet, const an_packet_view_t* an_packet);
 int decode_angular_acceleration_packet(angular_acceleration_packet_t* angular_acceleration_packet, an_packet_t* an_packet);
+int decode_angular_acceleration_packet_view(angular_acceleration_packet_t* angular_acceleration_packet, const an_packet_view_t* an_packet);
 int decode_external_position_velocity_packet(external_position_velocity_packet_t* external_position_velocity_packet, an_packet_t* an_packet);
+int decode_external_position_velocity_packet_view(external_position_velocity_packet_t* external_position_velocity_packet, const an_packet_view_t* an_packet);
 an_packet_t* encode_external_position_velocity_packet(external_position_velocity_packet_t* external_position_velocity_packet);
+int encode_external_position_velocity_packet_into(uint8_t* buffer, size_t capacity, external_position_velocity_packet_t* external_position_velocity_packet);
 int decode_external_position_packet(external_position_packet_t* external_position_packet, an_packet_t* an_packet);
+int decode_external_position_packet_view(external_position_packet_t* external_position_packet, const an_packet_view_t* an_packet);
 an_packet_t* encode_external_position_packet(external_position_packet_t* external_position_packet);
+int encode_external_position_packet_into(uint8_t* buffer, size_t capacity, external_position_packet_t* external_position_packet);
 int decode_external_velocity_packet(external_velocity_packet_t* external_velocity_packet, an_packet_t* an_packet);
+int decode_external_velocity_packet_view(external_velocity_packet_t* external_velocity_packet, const an_packet_view_t* an_packet);
 an_packet_t* encode_external_velocity_packet(external_velocity_packet_t* external_velocity_packet);
+int encode_external_velocity_packet_into(uint8_t* buffer, size_t capacity, external_velocity_packet_t* external_velocity_packet);
 int decode_external_body_velocity_packet(external_body_velocity_packet_t* external_body_velocity_packet, an_packet_t* an_packet);
+int decode_external_body_velocity_packet_view(external_body_velocity_packet_t* external_body_velocity_packet, const an_packet_view_t* an_packet);
 an_packet_t* encode_external_body_velocity_packet(external_body_velocity_packet_t* external_body_velocity_packet);
+int encode_external_body_velocity_packet_into(uint8_t* buffer, size_t capacity, external_body_velocity_packet_t* external_body_velocity_packet);
 int decode_external_heading_packet(external_heading_packet_t* external_heading_packet, an_packet_t* an_packet);
+int decode_external_heading_packet_view(external_heading_packet_t* external_heading_packet, const an_packet_view_t* an_packet);
 an_packet_t* encode_external_heading_packet(external_heading_packet_t* external_heading_packet);
+int encode_external_heading_packet_into(uint8_t* buffer, size_t capacity, external_heading_packet_t* external_heading_packet);
 int decode_running_time_packet(running_time_packet_t* running_time_packet, an_packet_t* an_packet);
+int decode_running_time_packet_view(running_time_packet_t* running_time_packet, const an_packet_view_t* an_packet);
 int decode_local_magnetics_packet(local_magnetics_packet_t* local_magnetics_packet, an_packet_t* an_packet);
+int decode_local_magnetics_packet_view(local_magnetics_packet_t* local_magnetics_packet, const an_packet_view_t* an_packet);
 int decode_odometer_state_packet(odometer_state_packet_t* odometer_state_packet, an_packet_t* an_packet);
+int decode_odometer_state_packet_view(odometer_state_packet_t* odometer_state_packet, const an_packet_view_t* an_packet);
 int decode_external_time_packet(external_time_packet_t* external_time_packet, an_packet_t* an_packet);
+int decode_external_time_packet_view(external_time_packet_t* external_time_packet, const an_packet_view_t* an_packet);
 an_packet_t* encode_external_time_packet(external_time_packet_t* external_time_packet);
+int encode_external_time_packet_into(uint8_t* buffer, size_t capacity, external_time_packet_t* external_time_packet);
 int decode_external_depth_packet(external_depth_packet_t* external_depth_packet, an_packet_t* an_packet);
+int decode_external_depth_packet_view(external_depth_packet_t* external_depth_packet, const an_packet_view_t* an_packet);
 an_packet_t* encode_external_depth_packet(external_depth_packet_t* external_depth_packet);
+int encode_external_depth_packet_into(uint8_t* buffer, size_t capacity, external_depth_packet_t* external_depth_packet);
 int decode_geoid_height_packet(geoid_height_packet_t* geoid_height_packet, an_packet_t* an_packet);
+int decode_geoid_height_packet_view(geoid_height_packet_t* geoid_height_packet, const an_packet_view_t* an_packet);
 an_packet_t* encode_rtcm_corrections_packet(rtcm_corrections_packet_t* rtcm_corrections_packet, int data_size);
+int encode_rtcm_corrections_packet_into(uint8_t* buffer, size_t capacity, rtcm_corrections_packet_t* rtcm_corrections_packet, int data_size);
 int decode_wind_packet(wind_packet_t* wind_packet, an_packet_t* an_packet);
+int decode_wind_packet_view(wind_packet_t* wind_packet, const an_packet_view_t* an_packet);
 an_packet_t* encode_wind_packet(wind_packet_t* wind_packet);
+int encode_wind_packet_into(uint8_t* buffer, size_t capacity, wind_packet_t* wind_packet);
 int decode_heave_packet(heave_packet_t* heave_packet, an_packet_t* an_packet);
+int decode_heave_packet_view(heave_packet_t* heave_packet, const an_packet_view_t* an_packet);
 int decode_raw_satellite_ephemeris_packet(raw_satellite_ephemeris_packet_t* raw_satellite_ephemeris_packet, an_packet_t* an_packet);
+int decode_raw_satellite_ephemeris_packet_view(raw_satellite_ephemeris_packet_t* raw_satellite_ephemeris_packet, const an_packet_view_t* an_packet);
 int decode_external_odometer_packet(odometer_packet_t* external_odometer_packet, an_packet_t* an_packet);
+int decode_external_odometer_packet_view(odometer_packet_t* external_odometer_packet, const an_packet_view_t* an_packet);
 an_packet_t* encode_external_odometer_packet(odometer_packet_t* external_odometer_packet);
+int encode_external_odometer_packet_into(uint8_t* buffer, size_t capacity, odometer_packet_t* external_odometer_packet);
 int decode_external_air_data_packet(external_air_data_packet_t* external_air_data_packet, an_packet_t* an_packet);
+int decode_external_air_data_packet_view(external_air_data_packet_t* external_air_data_packet, const an_packet_view_t* an_packet);
 an_packet_t* encode_external_air_data_packet(external_air_data_packet_t* external_air_data_packet);
+int encode_external_air_data_packet_into(uint8_t* buffer, size_t capacity, external_air_data_packet_t* external_air_data_packet);
 int decode_gnss_information_packet(gnss_receiver_information_packet_t* gnss_information_packet, an_packet_t* an_packet);
+int decode_gnss_information_packet_view(gnss_receiver_information_packet_t* gnss_information_packet, const an_packet_view_t* an_packet);
 int decode_raw_dvl_data_packet(raw_dvl_data_packet_t* raw_dvl_data_packet, an_packet_t* an_packet);
+int decode_raw_dvl_data_packet_view(raw_dvl_data_packet_t* raw_dvl_data_packet, const an_packet_view_t* an_packet);
 int decode_north_seeking_status_packet(north_seeking_status_packet_t* north_seeking_status_packet, an_packet_t* an_packet);
+int decode_north_seeking_status_packet_view(north_seeking_status_packet_t* north_seeking_status_packet, const an_packet_view_t* an_packet);
 int decode_gimbal_state_packet(gimbal_state_packet_t* gimbal_state_packet, an_packet_t* an_packet);
+int decode_gimbal_state_packet_view(gimbal_state_packet_t* gimbal_state_packet, const an_packet_view_t* an_packet);
 an_packet_t* encode_gimbal_state_packet(gimbal_state_packet_t* gimbal_state_packet);
+int encode_gimbal_state_packet_into(uint8_t* buffer, size_t capacity, gimbal_state_packet_t* gimbal_state_packet);
 int decode_automotive_packet(automotive_packet_t* automotive_packet, an_packet_t* an_packet);
+int decode_automotive_packet_view(automotive_packet_t* automotive_packet, const an_packet_view_t* an_packet);
 int decode_external_magnetometers_packet(external_magnetometers_packet_t* external_magnetometers_packet, an_packet_t* an_packet);
+int decode_external_magnetometers_packet_view(external_magnetometers_packet_t* external_magnetometers_packet, const an_packet_view_t* an_packet);
 an_packet_t* encode_external_magnetometers_packet(external_magnetometers_packet_t* external_magnetometers_packet);
+int encode_external_magnetometers_packet_into(uint8_t* buffer, size_t capacity, external_magnetometers_packet_t* external_magnetometers_packet);
 an_packet_t* encode_zero_angular_velocity_packet(zero_angular_velocity_packet_t* zero_angular_velocity_packet_t);
+int encode_zero_angular_velocity_packet_into(uint8_t* buffer, size_t capacity, zero_angular_velocity_packet_t* zero_angular_velocity_packet);
 int decode_extended_satellites_packet(extended_satellites_packet_t* extended_satellites_packet, an_packet_t* an_packet);
+int decode_extended_satellites_packet_view(extended_satellites_packet_t* extended_satellites_packet, const an_packet_view_t* an_packet);
 int decode_packet_timer_period_packet(packet_timer_period_packet_t* packet_timer_period_packet, an_packet_t* an_packet);
+int decode_packet_timer_period_packet_view(packet_timer_period_packet_t* packet_timer_period_packet, const an_packet_view_t* an_packet);
 an_packet_t* encode_packet_timer_period_packet(packet_timer_period_packet_t* packet_timer_period_packet);
+int encode_packet_timer_period_packet_into(uint8_t* buffer, size_t capacity, packet_timer_period_packet_t* packet_timer_period_packet);
 int decode_packet_periods_packet(packet_periods_packet_t* packet_periods_packet, an_packet_t* an_packet);
+int decode_packet_periods_packet_view(packet_periods_packet_t* packet_periods_packet, const an_packet_view_t* an_packet);
 an_packet_t* encode_packet_periods_packet(packet_periods_packet_t* packet_periods_packet);
+int encode_packet_periods_packet_into(uint8_t* buffer, size_t capacity, packet_periods_packet_t* packet_periods_packet);
 int decode_baud_rates_packet(baud_rates_packet_t* baud_rates_packet, an_packet_t* an_packet);
+int decode_baud_rates_packet_view(baud_rates_packet_t* baud_rates_packet, const an_packet_view_t* an_packet);
 an_packet_t* encode_baud_rates_packet(baud_rates_packet_t* baud_rates_packet);
+int encode_baud_rates_packet_into(uint8_t* buffer, size_t capacity, baud_rates_packet_t* baud_rates_packet);
+int decode_installation_alignment_packet(installation_alignment_packet_t* installation_alignment_packet, an_packet_t* an_packet);
+int decode_installation_alignment_packet_view(installation_alignment_packet_t* installation_alignment_packet, const an_packet_view_t* an_packet);
+an_packet_t* encode_installation_alignment_packet(installation_alignment_packet_t* installation_alignment_packet);
+int encode_installation_alignment_packet_into(uint8_t* buffer, size_t capacity, installation_alignment_packet_t* installation_alignment_packet);
 int decode_filter_options_packet(filter_options_packet_t* filter_options_packet, an_packet_t* an_packet);
+int decode_filter_options_packet_view(filter_options_packet_t* filter_options_packet, const an_packet_view_t* an_packet);
 an_packet_t* encode_filter_options_packet(filter_options_packet_t* filter_options_packet);
+int encode_filter_options_packet_into(uint8_t* buffer, size_t capacity, filter_options_packet_t* filter_options_packet);
 int decode_gpio_configuration_packet(gpio_configuration_packet_t* gpio_configuration_packet, an_packet_t* an_packet);
+int decode_gpio_configuration_packet_view(gpio_configuration_packet_t* gpio_configuration_packet, const an_packet_view_t* an_packet);
 an_packet_t* encode_gpio_configuration_packet(gpio_configuration_packet_t* gpio_configuration_packet);
+int encode_gpio_configuration_packet_into(uint8_t* buffer, size_t capacity, gpio_configuration_packet_t* gpio_configuration_packet);
 int decode_odometer_configuration_packet(odometer_configuration_packet_t* odometer_configuration_packet, an_packet_t* an_packet);
+int decode_odometer_configuration_packet_view(odometer_configuration_packet_t* odometer_configuration_packet, const an_packet_view_t* an_packet);
 an_packet_t* encode_odometer_configuration_packet(odometer_configuration_packet_t* odometer_configuration_packet);
+int encode_odometer_configuration_packet_into(uint8_t* buffer, size_t capacity, odometer_configuration_packet_t* odometer_configuration_packet);
 an_packet_t* encode_zero_alignment_packet(zero_alignment_packet_t* zero_alignment_packet);
+int encode_zero_alignment_packet_into(uint8_t* buffer, size_t capacity, zero_alignment_packet_t* zero_alignment_packet);
 int decode_heave_offset_packet(heave_offset_packet_t* heave_offset_packet, an_packet_t* an_packet);
+int decode_heave_offset_packet_view(heave_offset_packet_t* heave_offset_packet, const an_packet_view_t* an_packet);
 an_packet_t* encode_heave_offset_packet(heave_offset_packet_t* heave_offset_packet);
+int encode_heave_offset_packet_into(uint8_t* buffer, size_t capacity, heave_offset_packet_t* heave_offset_packet);
 int decode_gpio_output_configuration_packet(gpio_output_configuration_packet_t* gpio_output_configuration_packet, an_packet_t* an_packet);
+int decode_gpio_output_configuration_packet_view(gpio_output_configuration_packet_t* gpio_output_configuration_packet, const an_packet_view_t* an_packet);
 an_packet_t* encode_gpio_output_configuration_packet(gpio_output_configuration_packet_t* gpio_output_configuration_packet);
+int encode_gpio_output_configuration_packet_into(uint8_t* buffer, size_t capacity, gpio_output_configuration_packet_t* gpio_output_configuration_packet);
 int decode_dual_antenna_configuration_packet(dual_antenna_configuration_packet_t* dual_antenna_configuration_packet, an_packet_t* an_packet);
+int decode_dual_antenna_configuration_packet_view(dual_antenna_configuration_packet_t* dual_antenna_configuration_packet, const an_packet_view_t* an_packet);
 an_packet_t* encode_dual_antenna_configuration_packet(dual_antenna_configuration_packet_t* dual_antenna_configuration_packet);
+int encode_dual_antenna_configuration_packet_into(uint8_t* buffer, size_t capacity, dual_antenna_configuration_packet_t* dual_antenna_configuration_packet);
 int decode_gnss_configuration_packet(gnss_configuration_packet_t* gnss_configuration_packet, an_packet_t* an_packet);
+int decode_gnss_configuration_packet_view(gnss_configuration_packet_t* gnss_configuration_packet, const an_packet_view_t* an_packet);
 an_packet_t* encode_gnss_configuration_packet(gnss_configuration_packet_t* gnss_configuration_packet);
+int encode_gnss_configuration_packet_into(uint8_t* buffer, size_t capacity, gnss_configuration_packet_t* gnss_configuration_packet);
 int decode_user_data_packet(user_data_packet_t* user_data_packet, an_packet_t* an_packet);
+int decode_user_data_packet_view(user_data_packet_t* user_data_packet, const an_packet_view_t* an_packet);
 an_packet_t* encode_user_data_packet(user_data_packet_t* user_data_packet);
+int encode_user_data_packet_into(uint8_t* buffer, size_t capacity, user_data_packet_t* user_data_packet);
 int decode_gpio_input_configuration_packet(gpio_input_configuration_packet_t* gpio_input_configuration_packet, an_packet_t* an_packet);
+int decode_gpio_input_configuration_packet_view(gpio_input_configuration_packet_t* gpio_input_configuration_packet, const an_packet_view_t* an_packet);
 an_packet_t* encode_gpio_input_configuration_packet(gpio_input_configuration_packet_t* gpio_input_configuration_packet);
+int encode_gpio_input_configuration_packet_into(uint8_t* buffer, size_t capacity, gpio_input_configuration_packet_t* gpio_input_configuration_packet);
 int decode_ip_dataports_configuration_packet(ip_dataports_configuration_packet_t* ip_dataports_configuration_packet, an_packet_t* an_packet);
+int decode_ip_dataports_configuration_packet_view(ip_dataports_configuration_packet_t* ip_dataports_configuration_packet, const an_packet_view_t* an_packet);
 an_packet_t* encode_ip_dataports_configuration_packet(ip_dataports_configuration_packet_t* ip_dataports_configuration_packet);
+int encode_ip_dataports_configuration_packet_into(uint8_t* buffer, size_t capacity, ip_dataports_configuration_packet_t* ip_dataports_configuration_packet);
 int decode_can_configuration_packet(can_configuration_packet_t* can_configuration_packet, an_packet_t* an_packet);
+int decode_can_configuration_packet_view(can_configuration_packet_t* can_configuration_packet, const an_packet_view_t* an_packet);
 an_packet_t* encode_can_configuration_packet(can_configuration_packet_t* can_configuration_packet);
+int encode_can_configuration_packet_into(uint8_t* buffer, size_t capacity, can_configuration_packet_t* can_configuration_packet);
 
 #ifdef __cplusplus
 }
@@ -40,6 +40,7 @@ extern "C"
 
 #include <stdint.h>
 #include <stdlib.h>
+#include <time.h>
 
     /*****************************************************************************/
     /* Doxywizard specific */
@@ -68,6 +69,15 @@ extern "C"
 #define PARITY_BITMASK 0xF0000000
 #define BAUDRATE_BITMASK 0x0FFFFFFF
 
+    /**
+     * \brief Receive latency settings of a port opened with comOpenLowLatency()
+     */
+    typedef struct
+    {
+        int low_latency;   // 1 if the driver accepted ASYNC_LOW_LATENCY
+        int latency_timer; // USB serial latency timer in ms, -1 if the port has none
+    } COMLatency;
+
     /*****************************************************************************/
     /**
      * \fn int comEnumerate()
@@ -127,6 +137,32 @@ extern "C"
      */
     int comOpen(int index, int baudrate_and_parity);
 
+    /**
+     * \fn int comGetBaudRate(int index)
+     * \brief Get the baud rate achieved by the driver for an opened port
+     * \brief On Linux any rate the adapter supports may be requested from comOpen();
+     *        it fails if the achieved rate is not within COM_BAUD_TOLERANCE_PERCENT.
+     * \param[in] index port index
+     * \return baud rate, or 0 if the port is not open
+     */
+    int comGetBaudRate(int index);
+
+    /**
+     * \fn int comOpenLowLatency(int index, int baudrate_and_parity, COMLatency * latency)
+     * \brief Open a port as comOpen(), tuned to deliver each byte as soon as it arrives
+     * \brief Requests ASYNC_LOW_LATENCY from the driver and lowers the USB serial
+     *        latency timer (16 ms by default on FTDI adapters) to COM_LATENCY_TIMER_MS.
+     *        Settings the driver or permissions refuse are left as they were. Ports
+     *        are non-blocking, so termios VMIN/VTIME have no effect: bytes reach the
+     *        caller as soon as poll() on the descriptor wakes, which the latency
+     *        timer bounds for USB serial adapters.
+     * \param[in] index port index
+     * \param[in] baudrate_and_parity see comOpen()
+     * \param[out] latency settings in effect after opening, may be NULL
+     * \return 1 if opened, 0 if not available
+     */
+    int comOpenLowLatency(int index, int baudrate_and_parity, COMLatency *latency);
+
     /**
      * \fn void comClose(int index)
      * \brief Close an opened port
@@ -187,6 +223,102 @@ extern "C"
      */
     int comSetRts(int index, int state);
 
+    /**
+     * \fn int comGetHandle(int index)
+     * \brief Get the file descriptor of an opened port, for use with poll or epoll
+     * \param[in] index port index
+     * \return file descriptor, or -1 if the port is not open or the platform has none
+     */
+    int comGetHandle(int index);
+
+    /*****************************************************************************/
+    /* Handle based API
+     * Each open port is an independent handle and no state is shared between
+     * them, so different ports can be opened, read, written and closed from
+     * different threads without locking. A single handle must not be used from
+     * several threads at once. The index based functions above share a global
+     * port table and should not be mixed with threads. */
+
+    typedef struct com_handle com_handle_t;
+    typedef void (*com_path_callback_t)(const char *path, void *context);
+
+    /**
+     * \fn int com_enumerate_paths(com_path_callback_t callback, void * context)
+     * \brief Enumerate available serial ports without touching the global port table
+     * \param[in] callback called with the path of each port, e.g. /dev/ttyUSB0 or COM3
+     * \param[in] context passed to the callback
+     * \return number of ports found
+     */
+    int com_enumerate_paths(com_path_callback_t callback, void *context);
+
+    /**
+     * \fn int com_stable_path(const char * path, char * stable, size_t len)
+     * \brief Find a name for a port that survives it being unplugged and replugged
+     * \brief On Linux this is the matching /dev/serial/by-id link, which names USB
+     *        adapters by vendor, product and serial number rather than by the order
+     *        they were enumerated in.
+     * \param[in] path device path or port name, see com_open_path()
+     * \param[out] stable stable path, or the device path if there is none
+     * \param[in] len size of stable in bytes
+     * \return 1 if a stable path was found, otherwise 0
+     */
+    int com_stable_path(const char *path, char *stable, size_t len);
+
+    /**
+     * \fn com_handle_t * com_open_path(const char * path, int baudrate_and_parity)
+     * \brief Open a port by path, configured as comOpen()
+     * \param[in] path device path, or a port name such as ttyUSB0 or COM3
+     * \param[in] baudrate_and_parity see comOpen()
+     * \return handle, or NULL if the port could not be opened
+     */
+    com_handle_t *com_open_path(const char *path, int baudrate_and_parity);
+
+    /**
+     * \fn com_handle_t * com_open_path_low_latency(const char * path, int baudrate_and_parity, COMLatency * latency)
+     * \brief Open a port by path, configured as comOpenLowLatency()
+     */
+    com_handle_t *com_open_path_low_latency(const char *path, int baudrate_and_parity, COMLatency *latency);
+
+    /**
+     * \fn void com_close(com_handle_t * com)
+     * \brief Close a port and release its handle
+     */
+    void com_close(com_handle_t *com);
+
+    /**
+     * \brief Handle based equivalents of comWrite(), comRead(), comReadBlocking(),
+     *        comSetDtr(), comSetRts(), comGetBaudRate() and comGetHandle()
+     */
+    int com_write(com_handle_t *com, const unsigned char *buffer, size_t len);
+    int com_read(com_handle_t *com, unsigned char *buffer, size_t len);
+    int com_read_blocking(com_handle_t *com, unsigned char *buffer, size_t len, unsigned timeout);
+
+    /**
+     * \fn int com_read_until(com_handle_t * com, unsigned char * buffer, size_t len, size_t min_bytes, const struct timespec * timeout)
+     * \brief Wait until at least min_bytes are received or the timeout expires
+     * \brief Everything already available is read, up to len. The wait uses
+     *        ppoll() on Linux, so descriptors above FD_SETSIZE are supported and
+     *        timeouts have nanosecond resolution.
+     * \param[in] com port handle
+     * \param[out] buffer pointer to receive buffer
+     * \param[in] len length of receive buffer in bytes
+     * \param[in] min_bytes bytes to wait for, at least 1 and at most len
+     * \param[in] timeout longest time to wait, NULL to wait indefinitely
+     * \return number of bytes transferred, less than min_bytes on timeout or hang up
+     */
+    int com_read_until(com_handle_t *com, unsigned char *buffer, size_t len, size_t min_bytes, const struct timespec *timeout);
+
+    int com_set_dtr(com_handle_t *com, int state);
+    int com_set_rts(com_handle_t *com, int state);
+    int com_get_baudrate(com_handle_t *com);
+    int com_get_fd(com_handle_t *com);
+
+    /**
+     * \fn const char * com_get_path(com_handle_t * com)
+     * \brief Get the path a handle was opened with
+     */
+    const char *com_get_path(com_handle_t *com);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,178 @@
+/****************************************************************/
+/*                                                              */
+/*                     Advanced Navigation                      */
+/*                   Clock Offset Estimator                     */
+/*         Copyright 2023, Advanced Navigation Pty Ltd          */
+/*                                                              */
+/****************************************************************/
+/*
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include "adnav_clock_estimator.h"
+
+#include <math.h>
+
+namespace adnav {
+
+ClockEstimator::ClockEstimator(uint32_t window_size, double forgetting_factor)
+	: window_size_(window_size > 0 ? window_size : 1),
+	forgetting_factor_(forgetting_factor) {
+	if(!(forgetting_factor_ > 0.0 && forgetting_factor_ <= 1.0)) forgetting_factor_ = 0.99;
+	reset();
+}
+
+void ClockEstimator::reset() {
+	reference_offset_ = 0;
+	origin_ = 0;
+	window_count_ = 0;
+	window_minimum_ = 0;
+	window_device_time_ = 0;
+	s0_ = sx_ = sy_ = sxx_ = sxy_ = 0.0;
+	residual_ms_ = 0.0;
+	last_excess_delay_ = 0;
+	samples_ = 0;
+	windows_ = 0;
+}
+
+double ClockEstimator::fittedOffset(double x) const {
+	// Until the first window closes the running minimum is the best estimate.
+	if(windows_ == 0) return static_cast<double>(window_minimum_ - reference_offset_);
+
+	double denominator = s0_ * sxx_ - sx_ * sx_;
+	if(windows_ < 2 || denominator <= 1e-12 * s0_ * s0_) return sy_ / s0_;
+
+	double slope = (s0_ * sxy_ - sx_ * sy_) / denominator;
+	double intercept = (sy_ - slope * sx_) / s0_;
+	return intercept + slope * x;
+}
+
+void ClockEstimator::update(uint64_t device_time, uint64_t host_time) {
+	int64_t offset = static_cast<int64_t>(host_time - device_time);
+	if(samples_ == 0) {
+		reference_offset_ = offset;
+		origin_ = device_time;
+	}
+	samples_++;
+
+	if(window_count_ == 0 || offset < window_minimum_) {
+		window_minimum_ = offset;
+		window_device_time_ = device_time;
+	}
+	window_count_++;
+
+	double x = static_cast<double>(static_cast<int64_t>(device_time - origin_)) * 1e-9;
+	last_excess_delay_ = offset - reference_offset_ - llround(fittedOffset(x));
+	if(window_count_ < window_size_) return;
+
+	// Close the window and add its minimum to the regression, moving the
+	// origin to the new point so the sums stay small however long it runs.
+	double y = static_cast<double>(window_minimum_ - reference_offset_);
+	x = static_cast<double>(static_cast<int64_t>(window_device_time_ - origin_)) * 1e-9;
+	if(windows_ > 0) {
+		double residual = y - fittedOffset(x);
+		residual_ms_ = (windows_ == 1) ? residual * residual :
+			forgetting_factor_ * residual_ms_ + (1.0 - forgetting_factor_) * residual * residual;
+	}
+
+	s0_ *= forgetting_factor_;
+	sx_ *= forgetting_factor_;
+	sy_ *= forgetting_factor_;
+	sxx_ *= forgetting_factor_;
+	sxy_ *= forgetting_factor_;
+
+	sxx_ += x * (x * s0_ - 2.0 * sx_);
+	sxy_ -= x * sy_;
+	sx_ -= x * s0_;
+	origin_ = window_device_time_;
+
+	s0_ += 1.0;
+	sy_ += y;
+
+	windows_++;
+	window_count_ = 0;
+}
+
+bool ClockEstimator::deviceTime(const an_packet_view_t& an_packet, uint64_t* device_time) {
+	uint32_t seconds, microseconds;
+	if(an_packet.id == packet_id_system_state) {
+		system_state_packet_t system_state_packet;
+		if(decode_system_state_packet_view(&system_state_packet, &an_packet) != 0) return false;
+		seconds = system_state_packet.unix_time_seconds;
+		microseconds = system_state_packet.microseconds;
+	}
+	else if(an_packet.id == packet_id_unix_time) {
+		unix_time_packet_t unix_time_packet;
+		if(decode_unix_time_packet_view(&unix_time_packet, &an_packet) != 0) return false;
+		seconds = unix_time_packet.unix_time_seconds;
+		microseconds = unix_time_packet.microseconds;
+	}
+	else return false;
+
+	// The device reports zero until it has a time source.
+	if(seconds == 0) return false;
+	*device_time = static_cast<uint64_t>(seconds) * 1000000000ULL + static_cast<uint64_t>(microseconds) * 1000ULL;
+	return true;
+}
+
+bool ClockEstimator::update(const an_packet_view_t& an_packet) {
+	uint64_t device_time;
+	if(an_packet.timestamp == 0 || !deviceTime(an_packet, &device_time)) return false;
+	update(device_time, an_packet.timestamp);
+	return true;
+}
+
+uint64_t ClockEstimator::deviceToHost(uint64_t device_time) const {
+	if(samples_ == 0) return device_time;
+	double x = static_cast<double>(static_cast<int64_t>(device_time - origin_)) * 1e-9;
+	return device_time + reference_offset_ + llround(fittedOffset(x));
+}
+
+uint64_t ClockEstimator::hostToDevice(uint64_t host_time) const {
+	if(samples_ == 0) return host_time;
+	// The offset changes by parts per million across it, so a second pass is exact to well under a nanosecond.
+	uint64_t device_time = host_time - reference_offset_;
+	for(int i = 0; i < 2; i++) {
+		double x = static_cast<double>(static_cast<int64_t>(device_time - origin_)) * 1e-9;
+		device_time = host_time - reference_offset_ - llround(fittedOffset(x));
+	}
+	return device_time;
+}
+
+uint64_t ClockEstimator::correct(const an_packet_view_t& an_packet) const {
+	uint64_t device_time;
+	if(samples_ == 0 || !deviceTime(an_packet, &device_time)) return an_packet.timestamp;
+	return deviceToHost(device_time);
+}
+
+clock_estimate_t ClockEstimator::estimate() const {
+	clock_estimate_t estimate;
+	double denominator = s0_ * sxx_ - sx_ * sx_;
+	estimate.offset = (samples_ > 0) ? reference_offset_ + llround(fittedOffset(0.0)) : 0;
+	estimate.drift_ppm = (windows_ >= 2 && denominator > 1e-12 * s0_ * s0_) ?
+		(s0_ * sxy_ - sx_ * sy_) / denominator * 1e-3 : 0.0;
+	estimate.residual_rms = sqrt(residual_ms_);
+	estimate.excess_delay = last_excess_delay_;
+	estimate.samples = samples_;
+	estimate.windows = windows_;
+	estimate.locked = windows_ >= 2;
+	return estimate;
+}
+
+} // namespace adnav
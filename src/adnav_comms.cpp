@@ -29,6 +29,14 @@
 #else
 #endif
 #include "adnav_comms.h"
+#include "adnav_clock_estimator.h"
+
+#if !defined(WIN32) && !defined(_WIN32)
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <stdlib.h>
+	#include <fcntl.h>
+#endif
 
 namespace adnav {
 
@@ -42,12 +50,20 @@ void Communicator::initComms(const adnav_connections_data_t& ops) {
 
 		case CONNECTION_SERIAL:
 			validateBaudRate();
-			validateComPort();
+			#if !defined(__linux__)
+				if(ops.serial_reconnect) throw std::invalid_argument("Serial reconnect is only available on Linux");
+			#endif
+			// A reconnecting port may be unplugged until after open().
+			if(!ops.serial_reconnect) validateComPort();
+			else if(ops.com_port.empty()) throw std::invalid_argument("Invalid Com Port");
 			break;
 
 		case CONNECTION_TCP_CLIENT:
 			validateIpAddress();
 			validatePort();
+			#if !defined(__linux__)
+				if(ops.tcp_reconnect) throw std::invalid_argument("TCP reconnect is only available on Linux");
+			#endif
 			memset(&address_, 0, sizeof(address_));
 
 			// Startup winsock if on windows.
@@ -81,6 +97,15 @@ void Communicator::initComms(const adnav_connections_data_t& ops) {
 			servAddr_.sin_addr.s_addr = htonl(INADDR_ANY);
 			break;
 
+		case CONNECTION_FILE_REPLAY:
+			if(ops.file_path.empty()) {
+				throw std::invalid_argument("Invalid Replay File");
+			}
+			if(ops.replay_speed < 0) {
+				throw std::invalid_argument("Invalid Replay Speed");
+			}
+			break;
+
 		default:
 			throw std::runtime_error("Unknown communication type");
 			break;
@@ -101,18 +126,51 @@ void Communicator::open() {
 		break;
 
 	case CONNECTION_SERIAL:
+	#if defined(__linux__)
+		// Open the port once it is present and reopen it whenever it is removed.
+		if(connection_ops_.serial_reconnect) {
+			openLink();
+			break;
+		}
+	#endif
+
 		// Give user info
 		std::cout << std::endl << "Connection Type: Serial\nBaud Rate : " << connection_ops_.baud_rate << std::endl
 		<< "Com Port: " << connection_ops_.com_port << std::endl;
 
 		// Open connection
-		if (!static_cast<bool>(comOpen(connection_ops_.index, connection_ops_.baud_rate))) {
+		if(connection_ops_.serial_low_latency) {
+			COMLatency latency;
+			if ((serial_ = com_open_path_low_latency(connection_ops_.com_port.c_str(), connection_ops_.baud_rate, &latency)) == nullptr) {
+				ss << "Could not open serial port: " << connection_ops_.com_port << " at " << connection_ops_.baud_rate << " baud\nInvalid Serial Configuration.";
+				throw std::runtime_error(ss.str().c_str());
+			}
+			std::cout << "Low Latency: ASYNC_LOW_LATENCY " << (latency.low_latency ? "on" : "off") << ", Latency Timer ";
+			if(latency.latency_timer < 0) std::cout << "n/a" << std::endl;
+			else std::cout << latency.latency_timer << " ms" << std::endl;
+			if(latency.latency_timer > 1) {
+				std::cout << adnav::utils::BHYEL << "Unable to lower the USB serial latency timer, data will arrive in "
+				<< latency.latency_timer << " ms bursts." << adnav::utils::RESET << std::endl;
+			}
+		}
+		else if ((serial_ = com_open_path(connection_ops_.com_port.c_str(), connection_ops_.baud_rate)) == nullptr) {
 			ss << "Could not open serial port: " << connection_ops_.com_port << " at " << connection_ops_.baud_rate << " baud\nInvalid Serial Configuration.";
 			throw std::runtime_error(ss.str().c_str());
 		}
+		if(com_get_baudrate(serial_) != connection_ops_.baud_rate) {
+			std::cout << "Achieved Baud Rate: " << com_get_baudrate(serial_) << std::endl;
+		}
 		break;
 
 	case CONNECTION_TCP_CLIENT:
+	#if defined(__linux__)
+		// Connect in the background and restore the connection whenever it is lost.
+		if(connection_ops_.tcp_reconnect) {
+			openLink();
+			break;
+		}
+	#endif
+
 		// Generate Socket
 		if ((sock_ = socket(AF_INET, SOCK_STREAM, 0)) < 0) {
 			throw std::runtime_error("Unable to generate TCP socket");
@@ -186,13 +244,29 @@ void Communicator::open() {
 		std::cout << adnav::utils::BBLU << "Connection Available on:\n" << adnav::utils::getLocalInterfaces().c_str() <<
 			std::endl << "Port: " << ntohs(servAddr_.sin_port) << adnav::utils::RESET << std::endl << std::endl;
 		break;
+
+	case CONNECTION_FILE_REPLAY:
+		openReplay();
+		break;
 	}
 
+#if defined(__linux__)
+	if(!link_reactor_ && connection_ops_.method != CONNECTION_SERIAL && connection_ops_.method != CONNECTION_FILE_REPLAY) enableTimestamps();
+#endif
 	isOpen_ = true;
 }
 
 void Communicator::close() {
-	if(!this->isOpen()) std::cerr << "Unable to close an unopened socket." << std::endl;
+	if(!this->isOpen()) {
+		std::cerr << "Unable to close an unopened socket." << std::endl;
+		return;
+	}
+#if defined(__linux__)
+	detach();
+#endif
+#if defined(ADNAV_HAS_IO_URING)
+	uring_.reset();
+#endif
 	switch(connection_ops_.method)
 	 {
 		case CONNECTION_NOT_OPEN:
@@ -200,14 +274,22 @@ void Communicator::close() {
 			break;
 
 		case CONNECTION_SERIAL:
-			comClose(connection_ops_.index);
+			#if defined(__linux__)
+				if(link_reactor_) {
+					closeLink();
+					break;
+				}
+			#endif
+			com_close(serial_);
+			serial_ = nullptr;
 			break;
 
 		case CONNECTION_TCP_CLIENT:
 			#if defined(WIN32) || defined(_WIN32)
-				closesocket(connection_);
+				closesocket(sock_);
 			#else
-				::close(connection_);
+				if(link_reactor_) closeLink();
+				else ::close(sock_);
 			#endif
 			break;
 
@@ -215,9 +297,11 @@ void Communicator::close() {
 			#if defined(WIN32) || defined(_WIN32)
 				closesocket(sock_);
 				shutdown(server_, SD_BOTH);
+				closesocket(server_);
 			#else
 				::close(sock_);
 				shutdown(server_, SHUT_RDWR);
+				::close(server_);
 			#endif
 			break;
 
@@ -229,21 +313,33 @@ void Communicator::close() {
 			#endif
 			break;
 
+		case CONNECTION_FILE_REPLAY:
+			closeReplay();
+			break;
+
 		default:
 			throw std::runtime_error("Unable to close an unknown communications method");
 			break;
 	}
 
+	// Forget the descriptors so they are not closed again once reused.
 	#if defined(WIN32) || defined(_WIN32)
+		sock_ = connection_ = server_ = INVALID_SOCKET;
 		WSACleanup();
+	#else
+		sock_ = connection_ = server_ = -1;
 	#endif
+	isOpen_ = false;
 }
 
 int Communicator::read(void* buf, size_t len) {
-	char ip[INET_ADDRSTRLEN];
 	// Ensure that the communications are open.
 	if(!this->isOpen()) throw std::runtime_error("Unable to read from unopened socket");
 
+#if defined(__linux__)
+	if(link_reactor_) return pumpLink(-1) ? takeLink(buf, len, nullptr) : -1;
+#endif
+
 	// get the bytes from the communication method, and load them into the decoder
 	int received;
 	switch(connection_ops_.method)
@@ -253,7 +349,7 @@ int Communicator::read(void* buf, size_t len) {
 			break;
 
 		case CONNECTION_SERIAL:
-			received = comRead(connection_ops_.index, (unsigned char*) buf, len);
+			received = com_read(serial_, (unsigned char*) buf, len);
 			break;
 
 		case CONNECTION_TCP_CLIENT:
@@ -286,17 +382,14 @@ int Communicator::read(void* buf, size_t len) {
 			#endif
 			}
 
-			// If this is the first time receiving a datagram, tell the user and
-			// ensure we send back to the same port the data came from.
-			if(!UDPDatagramRecv) {
-				address_.sin_port = servAddr_.sin_port;
-				inet_ntop(AF_INET, &(address_.sin_addr), ip, INET_ADDRSTRLEN);
-				std::cout << adnav::utils::BGRN << "Datagram Recieved: \nIP: " << ip << std::endl
-					<< "Port: " << ntohs(address_.sin_port) << adnav::utils::RESET << std::endl << std::endl;
-				UDPDatagramRecv = true;
-			}
+			if(!UDPDatagramRecv) datagramReceived();
+
+			break;
 
+		case CONNECTION_FILE_REPLAY:
+			received = readReplay(buf, len);
 			break;
+
 		default:
 			throw std::runtime_error("Unable to read from unknown communication method.");
 			break;
@@ -304,6 +397,378 @@ int Communicator::read(void* buf, size_t len) {
 	return received;
 }
 
+#if defined(__linux__)
+// Current time in the same clock and units as SO_TIMESTAMPNS.
+static uint64_t realtimeNanoseconds() {
+	struct timespec now;
+	clock_gettime(CLOCK_REALTIME, &now);
+	return (uint64_t) now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+// Receive time from the control messages of a recvmsg call, or now if absent.
+static uint64_t receiveTimestamp(struct msghdr* message) {
+	for(struct cmsghdr* cmsg = CMSG_FIRSTHDR(message); cmsg != NULL; cmsg = CMSG_NXTHDR(message, cmsg)) {
+		if(cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_TIMESTAMPNS) {
+			struct timespec received;
+			memcpy(&received, CMSG_DATA(cmsg), sizeof(received));
+			return (uint64_t) received.tv_sec * 1000000000ULL + received.tv_nsec;
+		}
+	}
+	return realtimeNanoseconds();
+}
+
+void Communicator::enableTimestamps() {
+	int enable = 1;
+	if(setsockopt(sock_, SOL_SOCKET, SO_TIMESTAMPNS, &enable, sizeof(enable)) < 0) {
+		std::cerr << "Unable to enable receive timestamps: " << strerror(errno) << std::endl;
+	}
+}
+
+int Communicator::readTimestamped(void* buf, size_t len, uint64_t* timestamp) {
+	if(!this->isOpen()) throw std::runtime_error("Unable to read from unopened socket");
+
+	if(link_reactor_) return pumpLink(-1) ? takeLink(buf, len, timestamp) : -1;
+
+	if(connection_ops_.method == CONNECTION_SERIAL) {
+		int received = com_read(serial_, (unsigned char*) buf, len);
+		*timestamp = realtimeNanoseconds();
+		return received;
+	}
+	if(connection_ops_.method == CONNECTION_FILE_REPLAY) {
+		int received = readReplay(buf, len);
+		*timestamp = realtimeNanoseconds();
+		return received;
+	}
+
+	char control[CMSG_SPACE(sizeof(struct timespec))];
+	struct iovec vector;
+	struct msghdr message;
+	vector.iov_base = buf;
+	vector.iov_len = len;
+	memset(&message, 0, sizeof(message));
+	message.msg_iov = &vector;
+	message.msg_iovlen = 1;
+	message.msg_control = control;
+	message.msg_controllen = sizeof(control);
+	if(connection_ops_.method == CONNECTION_UDP_CLIENT) {
+		message.msg_name = &address_;
+		message.msg_namelen = addressLen_;
+	}
+
+	int received = recvmsg(sock_, &message, 0);
+	if(received < 0) {
+		std::cerr << "Error reading " << (connection_ops_.method == CONNECTION_UDP_CLIENT ? "UDP" : "TCP") <<
+			" Packet: " << strerror(errno) << std::endl;
+		return received;
+	}
+
+	*timestamp = receiveTimestamp(&message);
+	if(connection_ops_.method == CONNECTION_UDP_CLIENT && !UDPDatagramRecv) datagramReceived();
+	return received;
+}
+
+// Whole milliseconds left until a deadline, rounded up, 0 once it has passed.
+static int millisecondsUntil(std::chrono::steady_clock::time_point deadline) {
+	int64_t remaining = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - std::chrono::steady_clock::now()).count();
+	return (remaining > 0) ? static_cast<int>((remaining + 999999) / 1000000) : 0;
+}
+
+// Time left until a CLOCK_MONOTONIC deadline, false once it has passed.
+static bool timeRemaining(const struct timespec& deadline, struct timespec* remaining) {
+	clock_gettime(CLOCK_MONOTONIC, remaining);
+	remaining->tv_sec = deadline.tv_sec - remaining->tv_sec;
+	remaining->tv_nsec = deadline.tv_nsec - remaining->tv_nsec;
+	if(remaining->tv_nsec < 0) {
+		remaining->tv_sec--;
+		remaining->tv_nsec += 1000000000L;
+	}
+	return remaining->tv_sec >= 0;
+}
+
+int Communicator::readAtLeast(void* buf, size_t len, size_t min_bytes, int64_t timeout_ns) {
+	if(!this->isOpen()) throw std::runtime_error("Unable to read from unopened socket");
+
+	struct timespec timeout;
+	timeout.tv_sec = timeout_ns / 1000000000LL;
+	timeout.tv_nsec = timeout_ns % 1000000000LL;
+	const struct timespec* wait = (timeout_ns < 0) ? NULL : &timeout;
+
+	if(link_reactor_) {
+		uint8_t* data = static_cast<uint8_t*>(buf);
+		size_t received = 0;
+		auto deadline = std::chrono::steady_clock::now() + std::chrono::nanoseconds(timeout_ns);
+		do {
+			if(!pumpLink((timeout_ns < 0) ? -1 : millisecondsUntil(deadline))) break;
+			received += takeLink(data + received, len - received, nullptr);
+		} while(received < min_bytes && received < len);
+		return static_cast<int>(received);
+	}
+
+	switch(connection_ops_.method) {
+		case CONNECTION_SERIAL:
+			return com_read_until(serial_, (unsigned char*) buf, len, min_bytes, wait);
+
+		case CONNECTION_FILE_REPLAY:
+			return readReplay(buf, len);
+
+		case CONNECTION_UDP_CLIENT: {
+			struct pollfd descriptor = {sock_, POLLIN, 0};
+			int ready = ppoll(&descriptor, 1, wait, NULL);
+			if(ready < 0 && errno != EINTR) return -1;
+			if(ready <= 0) return 0;
+			return read(buf, len);
+		}
+
+		default:
+			break;
+	}
+
+	if(min_bytes < 1) min_bytes = 1;
+	if(min_bytes > len) min_bytes = len;
+
+	struct timespec deadline, remaining;
+	if(wait != NULL) {
+		clock_gettime(CLOCK_MONOTONIC, &deadline);
+		deadline.tv_sec += timeout.tv_sec;
+		deadline.tv_nsec += timeout.tv_nsec;
+		if(deadline.tv_nsec >= 1000000000L) {
+			deadline.tv_sec++;
+			deadline.tv_nsec -= 1000000000L;
+		}
+	}
+
+	uint8_t* data = static_cast<uint8_t*>(buf);
+	size_t received = 0;
+	struct pollfd descriptor = {sock_, POLLIN, 0};
+	while(received < min_bytes) {
+		// Take everything available, not just the minimum, to save wakeups.
+		ssize_t result = recv(sock_, data + received, len - received, MSG_DONTWAIT);
+		if(result > 0) {
+			received += result;
+			continue;
+		}
+		if(result == 0) break;
+		if(errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+			std::cerr << "Error reading TCP Packet: " << strerror(errno) << std::endl;
+			return received > 0 ? static_cast<int>(received) : -1;
+		}
+
+		if(wait != NULL && !timeRemaining(deadline, &remaining)) break;
+		descriptor.revents = 0;
+		int ready = ppoll(&descriptor, 1, (wait != NULL) ? &remaining : NULL, NULL);
+		if(ready < 0 && errno != EINTR) return received > 0 ? static_cast<int>(received) : -1;
+	}
+	return static_cast<int>(received);
+}
+
+int Communicator::readBatch(an_decoder_t* an_decoder, const std::function<void(const an_packet_view_t&)>& on_packet,
+	int max_datagrams) {
+	if(!this->isOpen()) throw std::runtime_error("Unable to read from unopened socket");
+
+	an_packet_view_t an_packet;
+	uint64_t timestamp;
+#if defined(ADNAV_HAS_IO_URING)
+	if(uring_) {
+		int received = uring_->wait([&](const uint8_t* data, size_t length) {
+			feedDecoder(an_decoder, data, length, realtimeNanoseconds(), on_packet);
+		});
+		if(received < 0) {
+			std::cerr << "Error reading TCP Packet: " << strerror(-received) << std::endl;
+			return -1;
+		}
+		return received;
+	}
+#endif
+	if(connection_ops_.method != CONNECTION_UDP_CLIENT) {
+		if(link_reactor_ && !pumpLink(-1)) return -1;
+		if(link_restored_) {
+			// Never join a packet cut short by the outage to the new stream.
+			an_decoder_initialise(an_decoder);
+			link_restored_ = false;
+		}
+		int received = readTimestamped(an_decoder_pointer(an_decoder), an_decoder_size(an_decoder), &timestamp);
+		if(received > 0) {
+			an_decoder_mark_timestamp(an_decoder, timestamp);
+			an_decoder_increment(an_decoder, received);
+			while(an_packet_decode_view(an_decoder, &an_packet)) on_packet(an_packet);
+		}
+		return received;
+	}
+
+	if(max_datagrams < 1) max_datagrams = 1;
+	if(max_datagrams > UDP_BATCH_SIZE) max_datagrams = UDP_BATCH_SIZE;
+	if(batch_buffer_.empty()) batch_buffer_.resize(UDP_BATCH_SIZE * UDP_DATAGRAM_BUFFER_SIZE);
+
+	struct mmsghdr messages[UDP_BATCH_SIZE];
+	struct iovec vectors[UDP_BATCH_SIZE];
+	struct sockaddr_in sources[UDP_BATCH_SIZE];
+	char controls[UDP_BATCH_SIZE][CMSG_SPACE(sizeof(struct timespec))];
+	memset(messages, 0, sizeof(messages));
+	for(int i = 0; i < max_datagrams; i++) {
+		vectors[i].iov_base = &batch_buffer_[i * UDP_DATAGRAM_BUFFER_SIZE];
+		vectors[i].iov_len = UDP_DATAGRAM_BUFFER_SIZE;
+		messages[i].msg_hdr.msg_iov = &vectors[i];
+		messages[i].msg_hdr.msg_iovlen = 1;
+		messages[i].msg_hdr.msg_name = &sources[i];
+		messages[i].msg_hdr.msg_namelen = sizeof(sources[i]);
+		messages[i].msg_hdr.msg_control = controls[i];
+		messages[i].msg_hdr.msg_controllen = sizeof(controls[i]);
+	}
+
+	// Block for the first datagram only, then take whatever else is queued.
+	int count = recvmmsg(sock_, messages, max_datagrams, MSG_WAITFORONE, NULL);
+	if(count < 0) {
+		std::cerr << "Error reading UDP Packet: " << strerror(errno) << std::endl;
+		return -1;
+	}
+
+	if(count > 0 && !UDPDatagramRecv) {
+		address_ = sources[0];
+		datagramReceived();
+	}
+
+	int received = 0;
+	for(int i = 0; i < count; i++) {
+		feedDecoder(an_decoder, &batch_buffer_[i * UDP_DATAGRAM_BUFFER_SIZE], messages[i].msg_len,
+			receiveTimestamp(&messages[i].msg_hdr), on_packet);
+		received += messages[i].msg_len;
+	}
+	return received;
+}
+
+void Communicator::feedDecoder(an_decoder_t* an_decoder, const uint8_t* data, size_t length, uint64_t timestamp,
+	const std::function<void(const an_packet_view_t&)>& on_packet) {
+	an_packet_view_t an_packet;
+	// Data larger than the decoder is fed in pieces.
+	while(length > 0) {
+		size_t piece = an_decoder_size(an_decoder);
+		if(piece > length) piece = length;
+		an_decoder_mark_timestamp(an_decoder, timestamp);
+		memcpy(an_decoder_pointer(an_decoder), data, piece);
+		an_decoder_increment(an_decoder, piece);
+		data += piece;
+		length -= piece;
+		while(an_packet_decode_view(an_decoder, &an_packet)) on_packet(an_packet);
+	}
+}
+
+bool Communicator::useIoUring() {
+#if defined(ADNAV_HAS_IO_URING)
+	if(!this->isOpen()) return false;
+	if(connection_ops_.method != CONNECTION_TCP_CLIENT && connection_ops_.method != CONNECTION_TCP_SERVER) return false;
+	if(link_reactor_) return false;
+	if(uring_) return true;
+
+	std::unique_ptr<UringReceiver> uring(new UringReceiver(sock_));
+	if(!uring->init()) return false;
+	uring_ = std::move(uring);
+	return true;
+#else
+	return false;
+#endif
+}
+
+int Communicator::writeAll(int fd, const struct iovec* buffers, int count) {
+	if(fd < 0) return -1;
+	write_vectors_.assign(buffers, buffers + count);
+	struct iovec* vectors = write_vectors_.data();
+
+	int written = 0;
+	int index = 0;
+	int overruns = 0;
+	while(index < count) {
+		// Skip buffers that have been completely written or were empty.
+		if(vectors[index].iov_len == 0) {
+			index++;
+			continue;
+		}
+
+		ssize_t result = writev(fd, &vectors[index], (count - index > IOV_MAX) ? IOV_MAX : count - index);
+		if(result < 0) {
+			if(errno == EINTR) continue;
+			if(errno == EAGAIN || errno == EWOULDBLOCK) {
+				write_stalls_.fetch_add(1, std::memory_order_relaxed);
+				struct pollfd descriptor = {fd, POLLOUT, 0};
+				int ready = poll(&descriptor, 1, WRITE_TIMEOUT_MS);
+				if(ready > 0 || (ready < 0 && errno == EINTR)) continue;
+				// Finish a buffer that is already partly on the wire rather than truncate it.
+				if(vectors[index].iov_base != buffers[index].iov_base && overruns++ < MAX_WRITE_STALLS) continue;
+				std::cerr << "Timed out writing " << (connection_ops_.method == CONNECTION_SERIAL ? "serial" : "TCP") <<
+					" data, " << written << " bytes written." << std::endl;
+				return written;
+			}
+			std::cerr << "Error sending " << (connection_ops_.method == CONNECTION_SERIAL ? "serial" : "TCP") <<
+				" data. Error: " << strerror(errno) << std::endl;
+			return written > 0 ? written : -1;
+		}
+
+		written += result;
+		while(index < count && (size_t) result >= vectors[index].iov_len) {
+			result -= vectors[index].iov_len;
+			index++;
+		}
+		if(index < count && result > 0) {
+			vectors[index].iov_base = (uint8_t*) vectors[index].iov_base + result;
+			vectors[index].iov_len -= result;
+		}
+		if(index < count) partial_writes_.fetch_add(1, std::memory_order_relaxed);
+	}
+	return written;
+}
+
+int Communicator::writeBatch(const struct iovec* buffers, int count) {
+	if(!this->isOpen()) throw std::runtime_error("Unable to write to unopened socket");
+	if(count <= 0) return 0;
+
+	int sent = 0;
+	switch(connection_ops_.method) {
+		case CONNECTION_SERIAL:
+			sent = link_reactor_ ? writeLink(buffers, count) : writeAll(com_get_fd(serial_), buffers, count);
+			break;
+
+		case CONNECTION_TCP_CLIENT:
+		case CONNECTION_TCP_SERVER:
+			sent = link_reactor_ ? writeLink(buffers, count) : writeAll(sock_, buffers, count);
+			break;
+
+		case CONNECTION_UDP_CLIENT: {
+			// Leave if we don't know where to send to
+			if(!UDPDatagramRecv) return sent;
+			struct mmsghdr messages[UDP_BATCH_SIZE];
+			int offset = 0;
+			while(offset < count) {
+				int batch = (count - offset > UDP_BATCH_SIZE) ? UDP_BATCH_SIZE : count - offset;
+				memset(messages, 0, sizeof(messages));
+				for(int i = 0; i < batch; i++) {
+					messages[i].msg_hdr.msg_iov = const_cast<struct iovec*>(&buffers[offset + i]);
+					messages[i].msg_hdr.msg_iovlen = 1;
+					messages[i].msg_hdr.msg_name = &address_;
+					messages[i].msg_hdr.msg_namelen = addressLen_;
+				}
+				int transmitted = sendmmsg(sock_, messages, batch, 0);
+				if(transmitted < 0) {
+					std::cerr << "Error sending UDP Packets. Error: " << strerror(errno) << std::endl;
+					return sent > 0 ? sent : -1;
+				}
+				for(int i = 0; i < transmitted; i++) sent += messages[i].msg_len;
+				if(transmitted < batch) break;
+				offset += batch;
+			}
+			break;
+		}
+
+		case CONNECTION_FILE_REPLAY:
+			for(int i = 0; i < count; i++) sent += buffers[i].iov_len;
+			break;
+
+		default:
+			throw std::runtime_error("Cannot write to unknown communication method");
+			break;
+	}
+	return sent;
+}
+#endif
+
 int Communicator::write(void* buf, size_t len) {
 	if(!this->isOpen()) throw std::runtime_error("Unable to write to unopened socket");
 	int sent = 0;
@@ -313,12 +778,26 @@ int Communicator::write(void* buf, size_t len) {
 			throw std::runtime_error("Unable to write to uninitialized communication method");
 			break;
 
-		case CONNECTION_SERIAL:
-			sent = comWrite(connection_ops_.index, (unsigned char*) buf, len);
+		case CONNECTION_SERIAL: {
+		#if defined(__linux__)
+			// The port is non-blocking, so resume short writes rather than truncating the packet.
+			struct iovec vector = {buf, len};
+			sent = link_reactor_ ? writeLink(&vector, 1) : writeAll(com_get_fd(serial_), &vector, 1);
+		#else
+			sent = com_write(serial_, (unsigned char*) buf, len);
+		#endif
 			break;
+		}
 
 		case CONNECTION_TCP_CLIENT:
 		case CONNECTION_TCP_SERVER:
+		#if defined(__linux__)
+			if(link_reactor_) {
+				struct iovec vector = {buf, len};
+				sent = writeLink(&vector, 1);
+				break;
+			}
+		#endif
 			if((sent = send(sock_, (char*) buf, len, 0)) < 0) {
 				std::cerr << "Error sending TCP Packet. Size " << len << "\tError: ";
 			#if defined(WIN32) || defined(_WIN32)
@@ -343,6 +822,11 @@ int Communicator::write(void* buf, size_t len) {
 			}
 			break;
 
+		case CONNECTION_FILE_REPLAY:
+			// Nothing to send to, accept the data so configuration writes succeed.
+			sent = len;
+			break;
+
 		default:
 			throw std::runtime_error("Cannot write to unknown communication method");
 			break;
@@ -350,6 +834,277 @@ int Communicator::write(void* buf, size_t len) {
 	return sent;
 }
 
+int Communicator::getFd() {
+	if(!this->isOpen()) return -1;
+	switch(connection_ops_.method) {
+		case CONNECTION_SERIAL:
+			#if defined(__linux__)
+				if(link_reactor_) return -1;
+			#endif
+			return com_get_fd(serial_);
+
+		case CONNECTION_TCP_CLIENT:
+		case CONNECTION_TCP_SERVER:
+		case CONNECTION_UDP_CLIENT:
+			#if defined(WIN32) || defined(_WIN32)
+				return -1;
+			#else
+				// A reconnecting connection changes descriptor, so it has none to give out.
+				return link_reactor_ ? -1 : sock_;
+			#endif
+
+		default:
+			return -1;
+	}
+}
+
+#if defined(__linux__)
+void Communicator::attach(Reactor& reactor, std::function<void(Communicator&, uint32_t)> on_data_ready) {
+	if(!this->isOpen()) throw std::runtime_error("Unable to attach an unopened connection to a reactor");
+	detach();
+
+	int fd = getFd();
+	if(fd < 0) throw std::runtime_error("Connection has no file descriptor to attach");
+
+	uint32_t events = EPOLLIN;
+	if(connection_ops_.method == CONNECTION_TCP_CLIENT || connection_ops_.method == CONNECTION_TCP_SERVER) {
+		events |= EPOLLRDHUP;
+	}
+
+	reactor.add(fd, events, [this, on_data_ready](uint32_t ready) {
+		on_data_ready(*this, ready);
+	});
+	reactor_ = &reactor;
+	reactor_fd_ = fd;
+}
+
+void Communicator::detach() {
+	if(reactor_ == nullptr) return;
+	reactor_->remove(reactor_fd_);
+	reactor_ = nullptr;
+	reactor_fd_ = -1;
+}
+
+void Communicator::openLink() {
+	link_reactor_.reset(new Reactor());
+	link_buffer_.clear();
+	link_offset_ = 0;
+	link_restored_ = false;
+
+	auto on_data = [this](const uint8_t* data, size_t length, uint64_t timestamp) {
+		if(link_offset_ == link_buffer_.size()) {
+			link_buffer_.clear();
+			link_offset_ = 0;
+			link_timestamp_ = timestamp;
+		}
+		link_buffer_.insert(link_buffer_.end(), data, data + length);
+	};
+	auto on_state_change = [this](link_state_e state, uint64_t outage_ms) {
+		if(state == LINK_CONNECTED) {
+			// Bytes still buffered from the previous connection may end part way through a packet.
+			link_buffer_.clear();
+			link_offset_ = 0;
+			link_restored_ = true;
+		}
+		if(link_state_handler_) link_state_handler_(state, outage_ms);
+	};
+
+	if(connection_ops_.method == CONNECTION_SERIAL) {
+		serial_reconnector_.reset(new SerialReconnector(*link_reactor_, connection_ops_.com_port,
+			connection_ops_.baud_rate, connection_ops_.serial_low_latency));
+		serial_reconnector_->onData(on_data);
+		serial_reconnector_->onStateChange(on_state_change);
+		serial_reconnector_->start();
+		return;
+	}
+
+	tcp_reconnector_.reset(new TcpReconnector(*link_reactor_, connection_ops_.ip_address, connection_ops_.port));
+	tcp_reconnector_->onData(on_data);
+	tcp_reconnector_->onStateChange(on_state_change);
+	tcp_reconnector_->start();
+}
+
+void Communicator::closeLink() {
+	// The reconnector unregisters from the reactor, so goes first.
+	tcp_reconnector_.reset();
+	serial_reconnector_.reset();
+	link_reactor_.reset();
+	link_buffer_.clear();
+	link_offset_ = 0;
+}
+
+bool Communicator::pumpLink(int timeout_ms) {
+	auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+	while(link_offset_ == link_buffer_.size()) {
+		int wait = (timeout_ms < 0) ? -1 : millisecondsUntil(deadline);
+		if(link_reactor_->runOnce(wait) < 0) return false;
+		if(wait == 0) break;
+	}
+	return link_offset_ < link_buffer_.size();
+}
+
+int Communicator::takeLink(void* buf, size_t len, uint64_t* timestamp) {
+	size_t count = std::min(len, link_buffer_.size() - link_offset_);
+	memcpy(buf, link_buffer_.data() + link_offset_, count);
+	link_offset_ += count;
+	if(timestamp != nullptr) *timestamp = link_timestamp_;
+	return static_cast<int>(count);
+}
+
+int Communicator::writeLink(const struct iovec* buffers, int count) {
+	int sent = 0;
+	for(int i = 0; i < count; i++) {
+		int written = serial_reconnector_ ? serial_reconnector_->write(buffers[i].iov_base, buffers[i].iov_len) :
+			tcp_reconnector_->write(buffers[i].iov_base, buffers[i].iov_len);
+		if(written < 0) return sent > 0 ? sent : -1;
+		sent += written;
+		if((size_t) written < buffers[i].iov_len) break;
+	}
+	return sent;
+}
+#endif
+
+void Communicator::openReplay() {
+	std::stringstream ss;
+	replay_offset_ = 0;
+	replay_size_ = 0;
+	replay_pending_ = false;
+	replay_packet_offset_ = 0;
+	replay_paced_ = connection_ops_.replay_speed > 0;
+	replay_device_origin_ = 0;
+	an_decoder_initialise(&replay_decoder_);
+
+	std::cout << std::endl << "Connection Type: File Replay\nFile: " << connection_ops_.file_path << std::endl
+	<< "Speed: ";
+	if(replay_paced_) std::cout << connection_ops_.replay_speed << "x" << std::endl << std::endl;
+	else std::cout << "Unpaced" << std::endl << std::endl;
+
+#if !defined(WIN32) && !defined(_WIN32)
+	if(connection_ops_.replay_mmap) {
+		int fd = ::open(connection_ops_.file_path.c_str(), O_RDONLY | O_CLOEXEC);
+		struct stat status;
+		if(fd < 0 || fstat(fd, &status) < 0) {
+			if(fd >= 0) ::close(fd);
+			ss << "Could not open replay file: " << connection_ops_.file_path;
+			throw std::runtime_error(ss.str().c_str());
+		}
+
+		replay_size_ = static_cast<size_t>(status.st_size);
+		if(replay_size_ > 0) {
+			void* map = mmap(NULL, replay_size_, PROT_READ, MAP_PRIVATE, fd, 0);
+			if(map == MAP_FAILED) {
+				::close(fd);
+				ss << "Could not map replay file: " << connection_ops_.file_path;
+				throw std::runtime_error(ss.str().c_str());
+			}
+			madvise(map, replay_size_, MADV_SEQUENTIAL);
+			replay_map_ = static_cast<const uint8_t*>(map);
+		}
+		// The mapping holds its own reference to the file.
+		::close(fd);
+		return;
+	}
+#endif
+
+	replay_file_ = fopen(connection_ops_.file_path.c_str(), "rb");
+	if(replay_file_ == nullptr) {
+		ss << "Could not open replay file: " << connection_ops_.file_path;
+		throw std::runtime_error(ss.str().c_str());
+	}
+}
+
+void Communicator::closeReplay() {
+#if !defined(WIN32) && !defined(_WIN32)
+	if(replay_map_ != nullptr) munmap(const_cast<uint8_t*>(replay_map_), replay_size_);
+#endif
+	replay_map_ = nullptr;
+	if(replay_file_ != nullptr) fclose(replay_file_);
+	replay_file_ = nullptr;
+	replay_pending_ = false;
+}
+
+size_t Communicator::replayData(uint8_t* buf, size_t len) {
+	if(replay_file_ != nullptr) return fread(buf, 1, len, replay_file_);
+
+	size_t remaining = replay_size_ - replay_offset_;
+	if(len > remaining) len = remaining;
+	if(len > 0) memcpy(buf, replay_map_ + replay_offset_, len);
+	replay_offset_ += len;
+	return len;
+}
+
+bool Communicator::nextReplayPacket() {
+	while(!an_packet_decode_view(&replay_decoder_, &replay_packet_)) {
+		size_t received = replayData(an_decoder_pointer(&replay_decoder_), an_decoder_size(&replay_decoder_));
+		if(received == 0) return false;
+		an_decoder_increment(&replay_decoder_, received);
+	}
+	replay_pending_ = true;
+	return true;
+}
+
+int Communicator::readReplay(void* buf, size_t len) {
+	if(!replay_paced_) return static_cast<int>(replayData(static_cast<uint8_t*>(buf), len));
+
+	// Paced replay returns whole packets, holding back each timed packet until
+	// its capture time, scaled by the replay speed, has elapsed since the first.
+	// A buffer smaller than a packet receives it over several reads.
+	uint8_t* out = static_cast<uint8_t*>(buf);
+	size_t copied = 0;
+	while(copied < len && (replay_pending_ || nextReplayPacket())) {
+		size_t size = AN_PACKET_HEADER_SIZE + replay_packet_.length;
+		if(replay_packet_offset_ == 0) {
+			if(copied > 0 && copied + size > len) break;
+
+			uint64_t device_time;
+			if(ClockEstimator::deviceTime(replay_packet_, &device_time)) {
+				// Return what precedes it before waiting.
+				if(copied > 0) break;
+
+				auto now = std::chrono::steady_clock::now();
+				if(replay_device_origin_ == 0 || device_time < replay_device_origin_) {
+					// First timed packet, or the capture restarts: play from here.
+					replay_device_origin_ = device_time;
+					replay_host_origin_ = now;
+				}
+				else {
+					auto due = replay_host_origin_ + std::chrono::nanoseconds(static_cast<int64_t>(
+						static_cast<double>(device_time - replay_device_origin_) / connection_ops_.replay_speed));
+					if(due > now) std::this_thread::sleep_until(due);
+				}
+			}
+		}
+
+		size_t count = std::min(size - replay_packet_offset_, len - copied);
+		if(replay_packet_offset_ < AN_PACKET_HEADER_SIZE) {
+			size_t header = std::min(count, AN_PACKET_HEADER_SIZE - replay_packet_offset_);
+			memcpy(out + copied, replay_packet_.header + replay_packet_offset_, header);
+			copied += header;
+			replay_packet_offset_ += header;
+			count -= header;
+		}
+		memcpy(out + copied, replay_packet_.data + (replay_packet_offset_ - AN_PACKET_HEADER_SIZE), count);
+		copied += count;
+		replay_packet_offset_ += count;
+
+		if(replay_packet_offset_ < size) break;
+		replay_packet_offset_ = 0;
+		replay_pending_ = false;
+	}
+	return static_cast<int>(copied);
+}
+
+void Communicator::datagramReceived() {
+	char ip[INET_ADDRSTRLEN];
+	// This is the first time receiving a datagram, tell the user and
+	// ensure we send back to the same port the data came from.
+	address_.sin_port = servAddr_.sin_port;
+	inet_ntop(AF_INET, &(address_.sin_addr), ip, INET_ADDRSTRLEN);
+	std::cout << adnav::utils::BGRN << "Datagram Recieved: \nIP: " << ip << std::endl
+		<< "Port: " << ntohs(address_.sin_port) << adnav::utils::RESET << std::endl << std::endl;
+	UDPDatagramRecv = true;
+}
+
 bool Communicator::validateBaudRate() {
 	switch(connection_ops_.baud_rate) {
 		case 2400:
@@ -369,16 +1124,55 @@ bool Communicator::validateBaudRate() {
 			break;
 
 		default:
+#if defined(__linux__)
+			// Any rate the adapter supports, comOpen() checks the rate achieved.
+			if(connection_ops_.baud_rate > 0 && connection_ops_.baud_rate <= BAUDRATE_BITMASK) break;
+#endif
 			throw std::invalid_argument("Invalid Baud Rate supplied");
 			return false;
 	}
 	return true;
 }
 
+// Enumeration state for validateComPort().
+struct com_port_search_t {
+	const std::string* name;
+	int count;
+	int index;
+};
+
+static void matchComPort(const char* path, void* context) {
+	com_port_search_t* search = static_cast<com_port_search_t*>(context);
+	// Ports may be given by path or by name, e.g. /dev/ttyUSB0 or ttyUSB0.
+	const char* name = strrchr(path, '/');
+	name = (name == nullptr) ? path : name + 1;
+	if(search->index == -1 && (*search->name == path || *search->name == name)) search->index = search->count;
+	search->count++;
+}
+
+// Ports outside the enumeration, such as /dev/serial/by-id links and ptys, are
+// accepted if they resolve to a terminal device. The port is not opened, which
+// could toggle the control lines of the device.
+static bool isTtyPath(const std::string& port) {
+#if defined(WIN32) || defined(_WIN32)
+	(void) port;
+	return false;
+#else
+	std::string device = (port.find('/') == std::string::npos) ? "/dev/" + port : port;
+	char resolved[PATH_MAX];
+	struct stat status;
+	if(realpath(device.c_str(), resolved) == NULL || stat(resolved, &status) < 0) return false;
+	if(!S_ISCHR(status.st_mode)) return false;
+	return strncmp(resolved, "/dev/tty", 8) == 0 || strncmp(resolved, "/dev/pts/", 9) == 0;
+#endif
+}
+
 bool Communicator::validateComPort() {
-	comEnumerate();
-	connection_ops_.index = comFindPort(connection_ops_.com_port.c_str());
-	if(connection_ops_.index == -1) {
+	// Enumerate without the global rs232 port table, which other threads may be using.
+	com_port_search_t search = {&connection_ops_.com_port, 0, -1};
+	com_enumerate_paths(matchComPort, &search);
+	connection_ops_.index = search.index;
+	if(connection_ops_.index == -1 && !isTtyPath(connection_ops_.com_port)) {
 		throw std::invalid_argument("Invalid Com Port");
 		return false;
 	}
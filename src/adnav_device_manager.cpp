@@ -0,0 +1,155 @@
+/****************************************************************/
+/*                                                              */
+/*                     Advanced Navigation                      */
+/*                       Device Manager                         */
+/*         Copyright 2023, Advanced Navigation Pty Ltd          */
+/*                                                              */
+/****************************************************************/
+/*
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include "adnav_device_manager.h"
+
+#if defined(__linux__)
+
+namespace adnav {
+
+DeviceManager::DeviceManager(int io_threads) {
+	if(io_threads < 1) throw std::invalid_argument("DeviceManager requires at least one I/O thread");
+	for(int i = 0; i < io_threads; i++) {
+		reactors_.emplace_back(new Reactor());
+	}
+}
+
+int DeviceManager::addDevice(const adnav_connections_data_t& ops) {
+	if(running_) throw std::runtime_error("Devices cannot be added while the manager is running");
+
+	std::unique_ptr<Device> device(new Device());
+	device->communicator.reset(new Communicator(ops));
+	an_decoder_initialise(&device->decoder);
+	device->thread = static_cast<int>(devices_.size() % reactors_.size());
+	devices_.push_back(std::move(device));
+	return static_cast<int>(devices_.size() - 1);
+}
+
+void DeviceManager::start() {
+	if(running_) return;
+
+	try {
+		for(size_t i = 0; i < devices_.size(); i++) {
+			Device& device = *devices_[i];
+			if(!device.communicator->isOpen()) device.communicator->open();
+			int index = static_cast<int>(i);
+			device.communicator->attach(*reactors_[device.thread], [this, index](Communicator&, uint32_t events) {
+				service(index, events);
+			});
+		}
+	}
+	catch(...) {
+		// Leave no device registered with a reactor that is not running.
+		for(auto& device : devices_) device->communicator->detach();
+		throw;
+	}
+
+	for(auto& reactor : reactors_) {
+		Reactor* loop = reactor.get();
+		threads_.emplace_back([loop]() { loop->run(); });
+	}
+	running_ = true;
+}
+
+void DeviceManager::stop() {
+	if(!running_) return;
+
+	for(auto& reactor : reactors_) reactor->stop();
+	for(auto& thread : threads_) {
+		if(thread.joinable()) thread.join();
+	}
+	threads_.clear();
+
+	for(auto& device : devices_) {
+		device->communicator->detach();
+		device->communicator->close();
+	}
+	running_ = false;
+}
+
+int DeviceManager::write(int device, void* buf, size_t len) {
+	Device& target = *devices_.at(device);
+	std::lock_guard<std::mutex> lock(target.write_mutex);
+	return target.communicator->write(buf, len);
+}
+
+void DeviceManager::service(int index, uint32_t events) {
+	Device& device = *devices_[index];
+	an_decoder_t* decoder = &device.decoder;
+
+	uint64_t decoded = 0;
+	int received = device.communicator->readBatch(decoder, [this, index, &decoded](const an_packet_view_t& an_packet) {
+		decoded++;
+		packet_handler_(index, an_packet);
+	});
+	if(received > 0) {
+		device.bytes_received.fetch_add(received, std::memory_order_relaxed);
+		device.packets_decoded.fetch_add(decoded, std::memory_order_relaxed);
+
+		// The decoder is only touched by this thread, publish its counters.
+		device.bytes_discarded.store(decoder->bytes_discarded, std::memory_order_relaxed);
+		device.lrc_errors.store(decoder->lrc_errors, std::memory_order_relaxed);
+		device.crc_errors.store(decoder->crc_errors, std::memory_order_relaxed);
+	}
+	else if(received < 0 || (events & (EPOLLERR | EPOLLHUP | EPOLLRDHUP))) {
+		// Stop servicing a failed connection rather than spinning on it.
+		device.read_errors.fetch_add(1, std::memory_order_relaxed);
+		device.communicator->detach();
+		std::cerr << adnav::utils::BHYEL << "Device " << index << " disconnected." << adnav::utils::RESET << std::endl;
+	}
+}
+
+device_statistics_t DeviceManager::statistics(int device) {
+	const Device& source = *devices_.at(device);
+	device_statistics_t statistics;
+	statistics.bytes_received = source.bytes_received.load(std::memory_order_relaxed);
+	statistics.packets_decoded = source.packets_decoded.load(std::memory_order_relaxed);
+	statistics.bytes_discarded = source.bytes_discarded.load(std::memory_order_relaxed);
+	statistics.lrc_errors = source.lrc_errors.load(std::memory_order_relaxed);
+	statistics.crc_errors = source.crc_errors.load(std::memory_order_relaxed);
+	statistics.read_errors = source.read_errors.load(std::memory_order_relaxed);
+	return statistics;
+}
+
+device_statistics_t DeviceManager::totalStatistics() {
+	device_statistics_t total;
+	memset(&total, 0, sizeof(total));
+	for(size_t i = 0; i < devices_.size(); i++) {
+		device_statistics_t statistics = this->statistics(static_cast<int>(i));
+		total.bytes_received += statistics.bytes_received;
+		total.packets_decoded += statistics.packets_decoded;
+		total.bytes_discarded += statistics.bytes_discarded;
+		total.lrc_errors += statistics.lrc_errors;
+		total.crc_errors += statistics.crc_errors;
+		total.read_errors += statistics.read_errors;
+	}
+	return total;
+}
+
+} // namespace adnav
+
+#endif // defined(__linux__)
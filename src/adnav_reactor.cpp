@@ -0,0 +1,191 @@
+/****************************************************************/
+/*                                                              */
+/*                     Advanced Navigation                      */
+/*                        Event Reactor                         */
+/*         Copyright 2023, Advanced Navigation Pty Ltd          */
+/*                                                              */
+/****************************************************************/
+/*
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include "adnav_reactor.h"
+
+#if defined(__linux__)
+
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+#include <stdexcept>
+#include <string>
+
+namespace adnav {
+
+Reactor::Reactor() {
+	if((epoll_fd_ = epoll_create1(EPOLL_CLOEXEC)) < 0) {
+		throw std::runtime_error(std::string("Unable to create epoll instance: ") + strerror(errno));
+	}
+
+	// eventfd used by stop() to interrupt a blocked epoll_wait.
+	if((wake_fd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) < 0) {
+		::close(epoll_fd_);
+		throw std::runtime_error(std::string("Unable to create reactor wake event: ") + strerror(errno));
+	}
+
+	struct epoll_event event;
+	memset(&event, 0, sizeof(event));
+	event.events = EPOLLIN;
+	event.data.u64 = 0;
+	if(epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, wake_fd_, &event) < 0) {
+		::close(wake_fd_);
+		::close(epoll_fd_);
+		throw std::runtime_error(std::string("Unable to register reactor wake event: ") + strerror(errno));
+	}
+}
+
+Reactor::~Reactor() {
+	::close(wake_fd_);
+	::close(epoll_fd_);
+}
+
+void Reactor::add(int fd, uint32_t events, callback_t callback) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	if(serials_.count(fd)) {
+		throw std::invalid_argument("File descriptor is already registered with the reactor");
+	}
+
+	uint64_t serial = next_serial_++;
+	struct epoll_event event;
+	memset(&event, 0, sizeof(event));
+	event.events = events;
+	event.data.u64 = serial;
+	if(epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd, &event) < 0) {
+		throw std::runtime_error(std::string("Unable to register file descriptor: ") + strerror(errno));
+	}
+
+	registrations_[serial] = std::make_shared<Registration>(Registration{fd, std::move(callback)});
+	serials_[fd] = serial;
+}
+
+void Reactor::modify(int fd, uint32_t events) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	auto it = serials_.find(fd);
+	if(it == serials_.end()) {
+		throw std::invalid_argument("File descriptor is not registered with the reactor");
+	}
+
+	struct epoll_event event;
+	memset(&event, 0, sizeof(event));
+	event.events = events;
+	event.data.u64 = it->second;
+	if(epoll_ctl(epoll_fd_, EPOLL_CTL_MOD, fd, &event) < 0) {
+		throw std::runtime_error(std::string("Unable to modify file descriptor: ") + strerror(errno));
+	}
+}
+
+void Reactor::remove(int fd) {
+	std::unique_lock<std::mutex> lock(mutex_);
+	auto it = serials_.find(fd);
+	if(it == serials_.end()) return;
+	uint64_t serial = it->second;
+
+	// The descriptor may already have been closed, in which case the kernel
+	// has removed it from the interest list and the error can be ignored.
+	epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, fd, NULL);
+	registrations_.erase(serial);
+	serials_.erase(it);
+
+	// The owner may be destroyed as soon as this returns, so let a callback
+	// running on the reactor thread finish. A callback removing itself cannot
+	// wait for itself.
+	if(dispatching_ == serial && std::this_thread::get_id() != dispatch_thread_) {
+		dispatched_.wait(lock, [this, serial]() { return dispatching_ != serial; });
+	}
+}
+
+int Reactor::runOnce(int timeout_ms) {
+	struct epoll_event events[MAX_EVENTS];
+	int ready = epoll_wait(epoll_fd_, events, MAX_EVENTS, timeout_ms);
+	if(ready < 0) {
+		return (errno == EINTR) ? 0 : -1;
+	}
+
+	int dispatched = 0;
+	for(int i = 0; i < ready; i++) {
+		if(events[i].data.u64 == 0) {
+			uint64_t count;
+			while(::read(wake_fd_, &count, sizeof(count)) > 0);
+			continue;
+		}
+
+		// Hold a reference so the callback survives being removed by itself.
+		std::shared_ptr<Registration> registration;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			auto it = registrations_.find(events[i].data.u64);
+			if(it == registrations_.end()) continue;
+			registration = it->second;
+			dispatching_ = it->first;
+			dispatch_thread_ = std::this_thread::get_id();
+		}
+		try {
+			registration->callback(events[i].events);
+		}
+		catch(...) {
+			finishDispatch();
+			throw;
+		}
+		finishDispatch();
+		dispatched++;
+	}
+	return dispatched;
+}
+
+void Reactor::run() {
+	running_.store(true);
+	while(!stop_requested_.load()) {
+		if(runOnce(-1) < 0) break;
+	}
+	stop_requested_.store(false);
+	running_.store(false);
+}
+
+void Reactor::stop() {
+	stop_requested_.store(true);
+	wake();
+}
+
+void Reactor::finishDispatch() {
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		dispatching_ = 0;
+	}
+	dispatched_.notify_all();
+}
+
+void Reactor::wake() {
+	uint64_t one = 1;
+	// A full counter already guarantees a wakeup, so EAGAIN is harmless.
+	if(::write(wake_fd_, &one, sizeof(one)) < 0) return;
+}
+
+} // namespace adnav
+
+#endif // defined(__linux__)
@@ -0,0 +1,314 @@
+/****************************************************************/
+/*                                                              */
+/*                     Advanced Navigation                      */
+/*                      TCP Reconnector                         */
+/*         Copyright 2023, Advanced Navigation Pty Ltd          */
+/*                                                              */
+/****************************************************************/
+/*
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include "adnav_reconnector.h"
+
+#include <string.h>
+#include <iostream>
+#include <stdexcept>
+
+#if defined(__linux__)
+
+#include <sys/socket.h>
+#include <sys/timerfd.h>
+#include <arpa/inet.h>
+#include <netinet/tcp.h>
+#include <unistd.h>
+#include <errno.h>
+#include <time.h>
+
+#include "adnav_utils.h"
+
+namespace adnav {
+
+static uint64_t monotonicMilliseconds() {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t) now.tv_sec * 1000ULL + (uint64_t) now.tv_nsec / 1000000ULL;
+}
+
+static uint64_t realtimeNanoseconds() {
+	struct timespec now;
+	clock_gettime(CLOCK_REALTIME, &now);
+	return (uint64_t) now.tv_sec * 1000000000ULL + (uint64_t) now.tv_nsec;
+}
+
+TcpReconnector::TcpReconnector(Reactor& reactor, const std::string& ip_address, int port,
+	int initial_backoff_ms, int max_backoff_ms)
+	: reactor_(reactor), initial_backoff_ms_(initial_backoff_ms), max_backoff_ms_(max_backoff_ms),
+	random_(std::random_device()()) {
+	if(port < 1 || port > 65535) throw std::invalid_argument("Invalid Port");
+	if(initial_backoff_ms < 1 || max_backoff_ms < initial_backoff_ms) throw std::invalid_argument("Invalid reconnect backoff");
+
+	memset(&address_, 0, sizeof(address_));
+	address_.sin_family = AF_INET;
+	address_.sin_port = htons(port);
+	if(inet_pton(AF_INET, ip_address.c_str(), &address_.sin_addr) <= 0) {
+		throw std::invalid_argument("Invalid IP Address");
+	}
+
+	an_decoder_initialise(&decoder_);
+	memset(&statistics_, 0, sizeof(statistics_));
+}
+
+void TcpReconnector::start() {
+	std::lock_guard<std::recursive_mutex> lock(mutex_);
+	if(running_) return;
+
+	timer_fd_ = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+	if(timer_fd_ < 0) throw std::runtime_error("Unable to create reconnect timer");
+	reactor_.add(timer_fd_, EPOLLIN, [this](uint32_t) { onTimer(); });
+
+	running_ = true;
+	attempt_ = 0;
+	disconnected_at_ms_ = monotonicMilliseconds();
+
+	char ip[INET_ADDRSTRLEN];
+	inet_ntop(AF_INET, &(address_.sin_addr), ip, INET_ADDRSTRLEN);
+	std::cout << std::endl << "Connection Type: TCP Client\nIP Address: " << ip << std::endl
+	<< "Port: " << ntohs(address_.sin_port) << std::endl << std::endl;
+
+	// Connect from the reactor thread, like every later attempt.
+	armTimer(0);
+}
+
+void TcpReconnector::stop() {
+	int sock, timer_fd;
+	{
+		std::lock_guard<std::recursive_mutex> lock(mutex_);
+		if(!running_) return;
+		running_ = false;
+		sock = sock_;
+		timer_fd = timer_fd_;
+	}
+
+	// Callbacks return straight away once running_ is clear. remove() waits
+	// for one in progress, which needs the lock, so it is called without it.
+	if(sock >= 0) reactor_.remove(sock);
+	reactor_.remove(timer_fd);
+
+	std::lock_guard<std::recursive_mutex> lock(mutex_);
+	closeSocket();
+	::close(timer_fd_);
+	timer_fd_ = -1;
+	state_ = LINK_DISCONNECTED;
+}
+
+int TcpReconnector::write(const void* buf, size_t len) {
+	std::lock_guard<std::recursive_mutex> lock(mutex_);
+	if(state_ != LINK_CONNECTED) return -1;
+
+	const uint8_t* data = static_cast<const uint8_t*>(buf);
+	size_t written = 0;
+	while(written < len) {
+		ssize_t sent = send(sock_, data + written, len - written, MSG_NOSIGNAL);
+		if(sent < 0) {
+			if(errno == EINTR) continue;
+			// A full send buffer returns what was accepted, a failed link is
+			// picked up by the read side.
+			if(errno == EAGAIN || errno == EWOULDBLOCK) break;
+			return -1;
+		}
+		written += sent;
+	}
+	return static_cast<int>(written);
+}
+
+link_state_e TcpReconnector::state() {
+	std::lock_guard<std::recursive_mutex> lock(mutex_);
+	return state_;
+}
+
+reconnector_statistics_t TcpReconnector::statistics() {
+	std::lock_guard<std::recursive_mutex> lock(mutex_);
+	reconnector_statistics_t statistics = statistics_;
+	// Include the outage in progress.
+	if(running_ && state_ != LINK_CONNECTED) statistics.outage_ms += monotonicMilliseconds() - disconnected_at_ms_;
+	return statistics;
+}
+
+void TcpReconnector::onTimer() {
+	std::lock_guard<std::recursive_mutex> lock(mutex_);
+	if(!running_) return;
+
+	uint64_t expirations;
+	if(::read(timer_fd_, &expirations, sizeof(expirations)) < 0) return;
+
+	if(state_ == LINK_CONNECTING) {
+		// connect() has not completed in time.
+		attemptFailed();
+	}
+	else if(state_ == LINK_DISCONNECTED) {
+		beginConnect();
+	}
+}
+
+void TcpReconnector::onSocket(uint32_t events) {
+	std::lock_guard<std::recursive_mutex> lock(mutex_);
+	if(!running_ || sock_ < 0) return;
+
+	if(state_ == LINK_CONNECTING) {
+		int error = 0;
+		socklen_t length = sizeof(error);
+		if(getsockopt(sock_, SOL_SOCKET, SO_ERROR, &error, &length) < 0) error = errno;
+		if(error == 0 && !(events & (EPOLLERR | EPOLLHUP))) connected();
+		else attemptFailed();
+		return;
+	}
+
+	an_packet_view_t an_packet;
+	while(state_ == LINK_CONNECTED) {
+		ssize_t received = recv(sock_, an_decoder_pointer(&decoder_), an_decoder_size(&decoder_), MSG_DONTWAIT);
+		if(received > 0) {
+			uint64_t timestamp = realtimeNanoseconds();
+			statistics_.bytes_received += received;
+			data_handler_(an_decoder_pointer(&decoder_), received, timestamp);
+			// Without a packet handler the decoder is only a receive buffer.
+			if(!decode_) continue;
+
+			an_decoder_mark_timestamp(&decoder_, timestamp);
+			an_decoder_increment(&decoder_, received);
+			while(an_packet_decode_view(&decoder_, &an_packet)) {
+				statistics_.packets_decoded++;
+				packet_handler_(an_packet);
+			}
+			continue;
+		}
+		if(received < 0 && errno == EINTR) continue;
+		if(received < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+
+		// Closed by the device, or failed.
+		connectionLost();
+	}
+}
+
+void TcpReconnector::beginConnect() {
+	sock_ = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+	if(sock_ < 0) {
+		std::cerr << "Unable to generate TCP socket: " << strerror(errno) << std::endl;
+		armTimer(backoff());
+		return;
+	}
+
+	statistics_.connect_attempts++;
+	state_ = LINK_CONNECTING;
+	if(connect(sock_, (struct sockaddr*) &address_, sizeof(address_)) == 0) {
+		reactor_.add(sock_, EPOLLIN | EPOLLRDHUP, [this](uint32_t events) { onSocket(events); });
+		connected();
+		return;
+	}
+	if(errno != EINPROGRESS) {
+		attemptFailed();
+		return;
+	}
+
+	// Writable once the handshake completes or fails.
+	reactor_.add(sock_, EPOLLOUT, [this](uint32_t events) { onSocket(events); });
+	armTimer(RECONNECT_CONNECT_TIMEOUT_MS);
+}
+
+void TcpReconnector::connected() {
+	reactor_.modify(sock_, EPOLLIN | EPOLLRDHUP);
+	armTimer(-1);
+
+	int nodelay = 1;
+	setsockopt(sock_, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay));
+
+	// Never join a packet cut short by the outage to the new stream.
+	an_decoder_initialise(&decoder_);
+	attempt_ = 0;
+
+	uint64_t outage_ms = monotonicMilliseconds() - disconnected_at_ms_;
+	statistics_.connects++;
+	statistics_.outage_ms += outage_ms;
+
+	// Bold Green text
+	std::cout << adnav::utils::BGRN << "Connection made: \n" << adnav::utils::getConnectionInfo(sock_, &address_).c_str() <<
+		adnav::utils::RESET << std::endl << std::endl;
+	setState(LINK_CONNECTED, outage_ms);
+}
+
+void TcpReconnector::attemptFailed() {
+	closeSocket();
+	state_ = LINK_DISCONNECTED;
+	int delay_ms = backoff();
+	attempt_++;
+
+	// High intensity Bold Yellow Text
+	std::cout << adnav::utils::BHYEL << "TCP Client Connection Failed, retrying in " << delay_ms << " ms" <<
+		adnav::utils::RESET << std::endl;
+	armTimer(delay_ms);
+}
+
+void TcpReconnector::connectionLost() {
+	closeSocket();
+	disconnected_at_ms_ = monotonicMilliseconds();
+	statistics_.disconnects++;
+	attempt_ = 0;
+
+	std::cerr << adnav::utils::BHYEL << "TCP Connection Lost, reconnecting." << adnav::utils::RESET << std::endl;
+	setState(LINK_DISCONNECTED, 0);
+	if(running_) armTimer(backoff());
+}
+
+void TcpReconnector::closeSocket() {
+	if(sock_ < 0) return;
+	reactor_.remove(sock_);
+	::close(sock_);
+	sock_ = -1;
+}
+
+void TcpReconnector::armTimer(int delay_ms) {
+	struct itimerspec timer;
+	memset(&timer, 0, sizeof(timer));
+	if(delay_ms >= 0) {
+		// A zero value disarms the timer, so fire as soon as possible instead.
+		timer.it_value.tv_sec = delay_ms / 1000;
+		timer.it_value.tv_nsec = (delay_ms % 1000) * 1000000L;
+		if(delay_ms == 0) timer.it_value.tv_nsec = 1;
+	}
+	timerfd_settime(timer_fd_, 0, &timer, NULL);
+}
+
+int TcpReconnector::backoff() {
+	// Exponential delay, randomised over its upper half.
+	int64_t delay = initial_backoff_ms_;
+	for(int i = 0; i < attempt_ && delay < max_backoff_ms_; i++) delay *= 2;
+	if(delay > max_backoff_ms_) delay = max_backoff_ms_;
+
+	std::uniform_int_distribution<int64_t> jitter(delay / 2, delay);
+	return static_cast<int>(jitter(random_));
+}
+
+void TcpReconnector::setState(link_state_e state, uint64_t outage_ms) {
+	state_ = state;
+	state_handler_(state, outage_ms);
+}
+
+} // namespace adnav
+
+#endif // defined(__linux__)
@@ -0,0 +1,307 @@
+/****************************************************************/
+/*                                                              */
+/*                     Advanced Navigation                      */
+/*                    Serial Reconnector                        */
+/*         Copyright 2023, Advanced Navigation Pty Ltd          */
+/*                                                              */
+/****************************************************************/
+/*
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include "adnav_serial_reconnector.h"
+
+#include <string.h>
+#include <iostream>
+#include <stdexcept>
+
+#if defined(__linux__)
+
+#include <sys/inotify.h>
+#include <sys/timerfd.h>
+#include <poll.h>
+#include <unistd.h>
+#include <errno.h>
+#include <time.h>
+
+#include "adnav_comms.h"
+#include "adnav_utils.h"
+
+namespace adnav {
+
+static uint64_t monotonicMilliseconds() {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t) now.tv_sec * 1000ULL + (uint64_t) now.tv_nsec / 1000000ULL;
+}
+
+static uint64_t realtimeNanoseconds() {
+	struct timespec now;
+	clock_gettime(CLOCK_REALTIME, &now);
+	return (uint64_t) now.tv_sec * 1000000000ULL + (uint64_t) now.tv_nsec;
+}
+
+SerialReconnector::SerialReconnector(Reactor& reactor, const std::string& port, int baud_rate, bool low_latency)
+	: reactor_(reactor), port_(port), baud_rate_(baud_rate), low_latency_(low_latency) {
+	if(port.empty()) throw std::invalid_argument("Invalid Com Port");
+	if(baud_rate <= 0) throw std::invalid_argument("Invalid Baud Rate supplied");
+
+	an_decoder_initialise(&decoder_);
+	memset(&statistics_, 0, sizeof(statistics_));
+}
+
+void SerialReconnector::start() {
+	std::lock_guard<std::recursive_mutex> lock(mutex_);
+	if(running_) return;
+
+	// Resolve the identity if the device is present, reopen() retries once it has been seen.
+	char stable[256];
+	com_stable_path(port_.c_str(), stable, sizeof(stable));
+	path_ = stable;
+
+	timer_fd_ = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+	if(timer_fd_ < 0) throw std::runtime_error("Unable to create reopen timer");
+	reactor_.add(timer_fd_, EPOLLIN, [this](uint32_t) { onTimer(); });
+
+	// Without inotify the timer alone finds the device again.
+	inotify_fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	if(inotify_fd_ >= 0) {
+		reactor_.add(inotify_fd_, EPOLLIN, [this](uint32_t) { onDeviceEvent(); });
+		watchDevices();
+	}
+
+	running_ = true;
+	disconnected_at_ms_ = monotonicMilliseconds();
+
+	std::cout << std::endl << "Connection Type: Serial\nBaud Rate : " << baud_rate_ << std::endl
+	<< "Com Port: " << path_ << std::endl;
+
+	if(!reopen()) {
+		std::cout << adnav::utils::BHYEL << "Waiting for " << path_ << adnav::utils::RESET << std::endl;
+		armTimer(true);
+	}
+}
+
+void SerialReconnector::stop() {
+	int fd, inotify_fd, timer_fd;
+	{
+		std::lock_guard<std::recursive_mutex> lock(mutex_);
+		if(!running_) return;
+		running_ = false;
+		fd = (serial_ != nullptr) ? fd_ : -1;
+		inotify_fd = inotify_fd_;
+		timer_fd = timer_fd_;
+	}
+
+	// Callbacks return straight away once running_ is clear. remove() waits
+	// for one in progress, which needs the lock, so it is called without it.
+	if(fd >= 0) reactor_.remove(fd);
+	if(inotify_fd >= 0) reactor_.remove(inotify_fd);
+	reactor_.remove(timer_fd);
+
+	std::lock_guard<std::recursive_mutex> lock(mutex_);
+	if(serial_ != nullptr) {
+		com_close(serial_);
+		serial_ = nullptr;
+		fd_ = -1;
+	}
+	if(inotify_fd_ >= 0) {
+		::close(inotify_fd_);
+		inotify_fd_ = -1;
+	}
+	::close(timer_fd_);
+	timer_fd_ = -1;
+	state_ = LINK_DISCONNECTED;
+}
+
+int SerialReconnector::write(const void* buf, size_t len) {
+	std::lock_guard<std::recursive_mutex> lock(mutex_);
+	if(state_ != LINK_CONNECTED) return -1;
+
+	// The port is non-blocking, so resume short writes and wait for it to drain.
+	const uint8_t* data = static_cast<const uint8_t*>(buf);
+	size_t written = 0;
+	int overruns = 0;
+	while(written < len) {
+		ssize_t result = ::write(fd_, data + written, len - written);
+		if(result >= 0) {
+			written += result;
+			continue;
+		}
+		if(errno == EINTR) continue;
+		if(errno != EAGAIN && errno != EWOULDBLOCK) {
+			std::cerr << "Error sending serial data. Error: " << strerror(errno) << std::endl;
+			return written > 0 ? static_cast<int>(written) : -1;
+		}
+
+		struct pollfd descriptor = {fd_, POLLOUT, 0};
+		int ready = poll(&descriptor, 1, WRITE_TIMEOUT_MS);
+		if(ready > 0 || (ready < 0 && errno == EINTR)) continue;
+		// Finish a write that is already partly on the wire rather than truncate it.
+		if(written > 0 && overruns++ < MAX_WRITE_STALLS) continue;
+		std::cerr << "Timed out writing serial data, " << written << " bytes written." << std::endl;
+		break;
+	}
+	return static_cast<int>(written);
+}
+
+link_state_e SerialReconnector::state() {
+	std::lock_guard<std::recursive_mutex> lock(mutex_);
+	return state_;
+}
+
+reconnector_statistics_t SerialReconnector::statistics() {
+	std::lock_guard<std::recursive_mutex> lock(mutex_);
+	reconnector_statistics_t statistics = statistics_;
+	// Include the outage in progress.
+	if(running_ && state_ != LINK_CONNECTED) statistics.outage_ms += monotonicMilliseconds() - disconnected_at_ms_;
+	return statistics;
+}
+
+std::string SerialReconnector::path() {
+	std::lock_guard<std::recursive_mutex> lock(mutex_);
+	return path_;
+}
+
+void SerialReconnector::onReadable(uint32_t events) {
+	std::lock_guard<std::recursive_mutex> lock(mutex_);
+	if(!running_ || state_ != LINK_CONNECTED) return;
+
+	an_packet_view_t an_packet;
+	while(state_ == LINK_CONNECTED) {
+		ssize_t received = ::read(fd_, an_decoder_pointer(&decoder_), an_decoder_size(&decoder_));
+		if(received > 0) {
+			uint64_t timestamp = realtimeNanoseconds();
+			statistics_.bytes_received += received;
+			data_handler_(an_decoder_pointer(&decoder_), received, timestamp);
+			// Without a packet handler the decoder is only a receive buffer.
+			if(!decode_) continue;
+
+			an_decoder_mark_timestamp(&decoder_, timestamp);
+			an_decoder_increment(&decoder_, received);
+			while(an_packet_decode_view(&decoder_, &an_packet)) {
+				statistics_.packets_decoded++;
+				packet_handler_(an_packet);
+			}
+			continue;
+		}
+		if(received < 0 && errno == EINTR) continue;
+		if(received < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+			// Nothing left to read from a port that has hung up.
+			if(events & (EPOLLHUP | EPOLLERR)) connectionLost();
+			break;
+		}
+
+		// A removed USB adapter fails reads with EIO, or reads as end of file.
+		connectionLost();
+	}
+}
+
+void SerialReconnector::onDeviceEvent() {
+	std::lock_guard<std::recursive_mutex> lock(mutex_);
+	if(!running_) return;
+
+	// Only the fact that /dev changed matters, not what changed.
+	alignas(struct inotify_event) char events[4096];
+	while(::read(inotify_fd_, events, sizeof(events)) > 0);
+
+	if(state_ == LINK_DISCONNECTED) {
+		// /dev/serial/by-id is created with the first adapter.
+		watchDevices();
+		reopen();
+	}
+}
+
+void SerialReconnector::onTimer() {
+	std::lock_guard<std::recursive_mutex> lock(mutex_);
+	if(!running_) return;
+
+	uint64_t expirations;
+	if(::read(timer_fd_, &expirations, sizeof(expirations)) < 0) return;
+	if(state_ == LINK_DISCONNECTED) reopen();
+}
+
+bool SerialReconnector::reopen() {
+	statistics_.connect_attempts++;
+	COMLatency latency;
+	serial_ = low_latency_ ? com_open_path_low_latency(path_.c_str(), baud_rate_, &latency) :
+		com_open_path(path_.c_str(), baud_rate_);
+	if(serial_ == nullptr) return false;
+
+	// A by-id link may only have appeared with the device, so prefer it from now on.
+	char stable[256];
+	if(com_stable_path(path_.c_str(), stable, sizeof(stable))) path_ = stable;
+
+	fd_ = com_get_fd(serial_);
+	reactor_.add(fd_, EPOLLIN, [this](uint32_t events) { onReadable(events); });
+	armTimer(false);
+
+	// Never join a packet cut short by the removal to the new stream.
+	an_decoder_initialise(&decoder_);
+
+	uint64_t outage_ms = monotonicMilliseconds() - disconnected_at_ms_;
+	statistics_.connects++;
+	statistics_.outage_ms += outage_ms;
+
+	// Bold Green text
+	std::cout << adnav::utils::BGRN << "Serial Port Opened: " << path_ << adnav::utils::RESET << std::endl;
+	setState(LINK_CONNECTED, outage_ms);
+	return true;
+}
+
+void SerialReconnector::connectionLost() {
+	reactor_.remove(fd_);
+	com_close(serial_);
+	serial_ = nullptr;
+	fd_ = -1;
+	disconnected_at_ms_ = monotonicMilliseconds();
+	statistics_.disconnects++;
+
+	std::cerr << adnav::utils::BHYEL << "Serial Port Removed: " << path_ << ", waiting for it to return." <<
+		adnav::utils::RESET << std::endl;
+	setState(LINK_DISCONNECTED, 0);
+	if(running_) armTimer(true);
+}
+
+void SerialReconnector::watchDevices() {
+	if(inotify_fd_ < 0) return;
+	// Watching a directory twice returns the existing watch.
+	inotify_add_watch(inotify_fd_, "/dev", IN_CREATE | IN_ATTRIB | IN_MOVED_TO);
+	inotify_add_watch(inotify_fd_, "/dev/serial/by-id", IN_CREATE | IN_ATTRIB | IN_MOVED_TO);
+}
+
+void SerialReconnector::armTimer(bool enable) {
+	struct itimerspec timer;
+	memset(&timer, 0, sizeof(timer));
+	if(enable) {
+		timer.it_value.tv_sec = SERIAL_REOPEN_INTERVAL_MS / 1000;
+		timer.it_value.tv_nsec = (SERIAL_REOPEN_INTERVAL_MS % 1000) * 1000000L;
+		timer.it_interval = timer.it_value;
+	}
+	timerfd_settime(timer_fd_, 0, &timer, NULL);
+}
+
+void SerialReconnector::setState(link_state_e state, uint64_t outage_ms) {
+	state_ = state;
+	state_handler_(state, outage_ms);
+}
+
+} // namespace adnav
+
+#endif // defined(__linux__)
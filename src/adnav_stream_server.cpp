@@ -0,0 +1,277 @@
+/****************************************************************/
+/*                                                              */
+/*                     Advanced Navigation                      */
+/*                       Stream Server                          */
+/*         Copyright 2023, Advanced Navigation Pty Ltd          */
+/*                                                              */
+/****************************************************************/
+/*
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include "adnav_stream_server.h"
+
+#include <string.h>
+#include <iostream>
+#include <stdexcept>
+
+#if defined(__linux__)
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <unistd.h>
+#include <errno.h>
+
+#include "adnav_utils.h"
+
+namespace adnav {
+
+StreamServer::StreamServer(Reactor& reactor, int port, size_t client_backlog, slow_client_policy_e policy)
+	: reactor_(reactor), port_(port), client_backlog_(client_backlog), policy_(policy) {
+	if(port < 1 || port > 65535) throw std::invalid_argument("Invalid Port");
+	memset(&statistics_, 0, sizeof(statistics_));
+}
+
+void StreamServer::open() {
+	if(listen_fd_ >= 0) return;
+
+	int fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+	if(fd < 0) {
+		throw std::runtime_error("Unable to generate TCP socket");
+	}
+
+	int reuse = 1;
+	setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+	struct sockaddr_in address;
+	memset(&address, 0, sizeof(address));
+	address.sin_family = AF_INET;
+	address.sin_addr.s_addr = htonl(INADDR_ANY);
+	address.sin_port = htons(port_);
+
+	if(bind(fd, (struct sockaddr*) &address, sizeof(address)) < 0) {
+		::close(fd);
+		throw std::runtime_error("Error binding socket to local address");
+	}
+	if(listen(fd, SOMAXCONN) < 0) {
+		::close(fd);
+		throw std::runtime_error("Unable to listen for connections");
+	}
+
+	listen_fd_ = fd;
+	reactor_.add(listen_fd_, EPOLLIN, [this](uint32_t) { acceptClients(); });
+
+	std::cout << adnav::utils::BBLU << "Streaming to clients on:\n" << adnav::utils::getLocalInterfaces().c_str() <<
+		std::endl << "Port: " << port_ << adnav::utils::RESET << std::endl << std::endl;
+}
+
+void StreamServer::close() {
+	if(listen_fd_ >= 0) {
+		reactor_.remove(listen_fd_);
+		::close(listen_fd_);
+		listen_fd_ = -1;
+	}
+
+	std::unordered_map<uint64_t, std::unique_ptr<Client>> clients;
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		clients.swap(clients_);
+	}
+	for(auto& entry : clients) disconnect(entry.second->fd);
+}
+
+void StreamServer::broadcast(const void* buf, size_t len) {
+	if(len == 0) return;
+	const uint8_t* data = static_cast<const uint8_t*>(buf);
+	broadcast(std::make_shared<std::vector<uint8_t>>(data, data + len));
+}
+
+void StreamServer::broadcast(stream_chunk_t chunk) {
+	if(!chunk || chunk->empty()) return;
+	size_t size = chunk->size();
+
+	std::unique_lock<std::mutex> lock(mutex_);
+	statistics_.chunks_broadcast++;
+	statistics_.bytes_broadcast += size;
+
+	std::vector<uint64_t> slow;
+	for(auto& entry : clients_) {
+		Client& client = *entry.second;
+		if(!client.pending.empty() && client.pending_bytes + size > client_backlog_) {
+			if(policy_ == SLOW_CLIENT_SKIP) statistics_.chunks_skipped++;
+			else slow.push_back(entry.first);
+			continue;
+		}
+
+		client.pending.push_back(chunk);
+		client.pending_bytes += size;
+
+		// A client that is keeping up is written to straight away, otherwise
+		// the reactor sends the chunk once the client has drained.
+		if(!client.writable_wait && !flush(client)) slow.push_back(entry.first);
+	}
+
+	std::vector<int> dropped;
+	for(uint64_t id : slow) dropped.push_back(drop(id, true));
+	lock.unlock();
+	for(int fd : dropped) disconnect(fd);
+}
+
+size_t StreamServer::clientCount() {
+	std::lock_guard<std::mutex> lock(mutex_);
+	return clients_.size();
+}
+
+stream_server_statistics_t StreamServer::statistics() {
+	std::lock_guard<std::mutex> lock(mutex_);
+	stream_server_statistics_t statistics = statistics_;
+	statistics.clients = clients_.size();
+	return statistics;
+}
+
+void StreamServer::acceptClients() {
+	while(true) {
+		int fd = accept4(listen_fd_, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+		if(fd < 0) {
+			if(errno == EINTR || errno == ECONNABORTED) continue;
+			return;
+		}
+
+		int nodelay = 1;
+		setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay));
+
+		std::cout << adnav::utils::BGRN << "Stream Client Connected: \n" << adnav::utils::getConnectionInfo(fd).c_str() <<
+			adnav::utils::RESET << std::endl << std::endl;
+
+		std::lock_guard<std::mutex> lock(mutex_);
+		uint64_t id = next_id_++;
+		std::unique_ptr<Client> client(new Client());
+		client->fd = fd;
+		client->offset = 0;
+		client->pending_bytes = 0;
+		client->writable_wait = false;
+		clients_[id] = std::move(client);
+		statistics_.clients_accepted++;
+
+		reactor_.add(fd, EPOLLIN | EPOLLRDHUP, [this, id](uint32_t events) { service(id, events); });
+	}
+}
+
+void StreamServer::service(uint64_t id, uint32_t events) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	auto it = clients_.find(id);
+	if(it == clients_.end()) return;
+	Client& client = *it->second;
+
+	// On the reactor thread remove() does not wait, so clients can be
+	// disconnected with the lock held.
+	if(events & EPOLLERR) {
+		disconnect(drop(id, true));
+		return;
+	}
+
+	if(events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP)) {
+		// Clients only listen, discard anything they send and watch for them leaving.
+		uint8_t discard[512];
+		while(true) {
+			ssize_t received = recv(client.fd, discard, sizeof(discard), MSG_DONTWAIT);
+			if(received > 0) continue;
+			if(received < 0 && errno == EINTR) continue;
+			if(received == 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) {
+				disconnect(drop(id, false));
+				return;
+			}
+			break;
+		}
+	}
+
+	if((events & EPOLLOUT) && !flush(client)) disconnect(drop(id, true));
+}
+
+bool StreamServer::flush(Client& client) {
+	struct iovec vectors[STREAM_SERVER_WRITE_VECTORS];
+
+	while(!client.pending.empty()) {
+		int count = 0;
+		for(auto it = client.pending.begin(); it != client.pending.end() && count < STREAM_SERVER_WRITE_VECTORS; ++it) {
+			size_t skip = (count == 0) ? client.offset : 0;
+			vectors[count].iov_base = const_cast<uint8_t*>((*it)->data()) + skip;
+			vectors[count].iov_len = (*it)->size() - skip;
+			count++;
+		}
+
+		struct msghdr message;
+		memset(&message, 0, sizeof(message));
+		message.msg_iov = vectors;
+		message.msg_iovlen = count;
+
+		ssize_t sent = sendmsg(client.fd, &message, MSG_NOSIGNAL | MSG_DONTWAIT);
+		if(sent < 0) {
+			if(errno == EINTR) continue;
+			if(errno == EAGAIN || errno == EWOULDBLOCK) break;
+			return false;
+		}
+
+		client.pending_bytes -= sent;
+		size_t remaining = sent;
+		while(remaining > 0) {
+			size_t left = client.pending.front()->size() - client.offset;
+			if(remaining < left) {
+				client.offset += remaining;
+				break;
+			}
+			remaining -= left;
+			client.offset = 0;
+			client.pending.pop_front();
+		}
+	}
+
+	// Only ask for EPOLLOUT while there is something left to send.
+	bool waiting = !client.pending.empty();
+	if(waiting != client.writable_wait) {
+		reactor_.modify(client.fd, EPOLLIN | EPOLLRDHUP | (waiting ? (uint32_t) EPOLLOUT : 0u));
+		client.writable_wait = waiting;
+	}
+	return true;
+}
+
+int StreamServer::drop(uint64_t id, bool slow) {
+	auto it = clients_.find(id);
+	if(it == clients_.end()) return -1;
+
+	int fd = it->second->fd;
+	clients_.erase(it);
+
+	if(slow) {
+		statistics_.clients_dropped++;
+		std::cerr << adnav::utils::BHYEL << "Stream client dropped." << adnav::utils::RESET << std::endl;
+	}
+	return fd;
+}
+
+void StreamServer::disconnect(int fd) {
+	if(fd < 0) return;
+	reactor_.remove(fd);
+	::close(fd);
+}
+
+} // namespace adnav
+
+#endif // defined(__linux__)
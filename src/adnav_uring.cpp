@@ -0,0 +1,216 @@
+/****************************************************************/
+/*                                                              */
+/*                     Advanced Navigation                      */
+/*                     io_uring Receiver                        */
+/*         Copyright 2023, Advanced Navigation Pty Ltd          */
+/*                                                              */
+/****************************************************************/
+/*
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include "adnav_uring.h"
+
+#if defined(ADNAV_HAS_IO_URING)
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+#include <new>
+
+namespace adnav {
+
+// Identifies completions of the posted receive.
+static constexpr uint64_t URING_RECEIVE = 1;
+static constexpr uint16_t URING_BUFFER_GROUP = 0;
+
+bool UringReceiver::init() {
+	if(ring_fd_ >= 0) return true;
+	if(buffer_count_ == 0 || (buffer_count_ & (buffer_count_ - 1)) != 0 || buffer_count_ > 32768) return false;
+
+	struct io_uring_params params;
+	memset(&params, 0, sizeof(params));
+	ring_fd_ = (int) syscall(__NR_io_uring_setup, 4, &params);
+	if(ring_fd_ < 0) return false;
+
+	sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+	cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+	bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+	if(single_mmap && cq_ring_size_ > sq_ring_size_) sq_ring_size_ = cq_ring_size_;
+
+	sq_ring_ = mmap(NULL, sq_ring_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQ_RING);
+	if(sq_ring_ == MAP_FAILED) {
+		sq_ring_ = nullptr;
+		destroy();
+		return false;
+	}
+	if(single_mmap) cq_ring_ = sq_ring_;
+	else {
+		cq_ring_ = mmap(NULL, cq_ring_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_CQ_RING);
+		if(cq_ring_ == MAP_FAILED) {
+			cq_ring_ = nullptr;
+			destroy();
+			return false;
+		}
+	}
+
+	sqes_size_ = params.sq_entries * sizeof(struct io_uring_sqe);
+	sqes_ = (struct io_uring_sqe*) mmap(NULL, sqes_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQES);
+	if(sqes_ == MAP_FAILED) {
+		sqes_ = nullptr;
+		destroy();
+		return false;
+	}
+
+	uint8_t* sq = (uint8_t*) sq_ring_;
+	uint8_t* cq = (uint8_t*) cq_ring_;
+	sq_head_ = (unsigned*) (sq + params.sq_off.head);
+	sq_tail_ = (unsigned*) (sq + params.sq_off.tail);
+	sq_mask_ = (unsigned*) (sq + params.sq_off.ring_mask);
+	sq_array_ = (unsigned*) (sq + params.sq_off.array);
+	cq_head_ = (unsigned*) (cq + params.cq_off.head);
+	cq_tail_ = (unsigned*) (cq + params.cq_off.tail);
+	cq_mask_ = (unsigned*) (cq + params.cq_off.ring_mask);
+	cqes_ = (struct io_uring_cqe*) (cq + params.cq_off.cqes);
+
+	// The buffer ring must be page aligned, an anonymous mapping guarantees it.
+	buffer_ring_size_ = buffer_count_ * sizeof(struct io_uring_buf);
+	void* buffer_ring = mmap(NULL, buffer_ring_size_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if(buffer_ring == MAP_FAILED) {
+		destroy();
+		return false;
+	}
+	buffer_ring_ = (struct io_uring_buf*) buffer_ring;
+	buffers_ = new (std::nothrow) uint8_t[(size_t) buffer_count_ * buffer_size_];
+	if(buffers_ == nullptr) {
+		destroy();
+		return false;
+	}
+
+	struct io_uring_buf_reg registration;
+	memset(&registration, 0, sizeof(registration));
+	registration.ring_addr = (uint64_t) (uintptr_t) buffer_ring_;
+	registration.ring_entries = buffer_count_;
+	registration.bgid = URING_BUFFER_GROUP;
+	if(syscall(__NR_io_uring_register, ring_fd_, IORING_REGISTER_PBUF_RING, &registration, 1) < 0) {
+		destroy();
+		return false;
+	}
+	buffers_registered_ = true;
+
+	for(unsigned i = 0; i < buffer_count_; i++) recycleBuffer((uint16_t) i);
+
+	if(!postReceive()) {
+		destroy();
+		return false;
+	}
+	return true;
+}
+
+void UringReceiver::destroy() {
+	// Closing the ring cancels the posted receive before its buffers are released.
+	if(ring_fd_ >= 0) ::close(ring_fd_);
+	ring_fd_ = -1;
+	buffers_registered_ = false;
+
+	if(sqes_ != nullptr) munmap(sqes_, sqes_size_);
+	if(cq_ring_ != nullptr && cq_ring_ != sq_ring_) munmap(cq_ring_, cq_ring_size_);
+	if(sq_ring_ != nullptr) munmap(sq_ring_, sq_ring_size_);
+	if(buffer_ring_ != nullptr) munmap(buffer_ring_, buffer_ring_size_);
+	delete[] buffers_;
+	sqes_ = nullptr;
+	cq_ring_ = nullptr;
+	sq_ring_ = nullptr;
+	buffer_ring_ = nullptr;
+	buffers_ = nullptr;
+}
+
+void UringReceiver::recycleBuffer(uint16_t id) {
+	uint16_t tail = buffer_ring_[0].resv;
+	struct io_uring_buf* buffer = &buffer_ring_[tail & (buffer_count_ - 1)];
+	buffer->addr = (uint64_t) (uintptr_t) &buffers_[(size_t) id * buffer_size_];
+	buffer->len = buffer_size_;
+	buffer->bid = id;
+	__atomic_store_n(&buffer_ring_[0].resv, (uint16_t) (tail + 1), __ATOMIC_RELEASE);
+}
+
+bool UringReceiver::postReceive() {
+	unsigned tail = *sq_tail_;
+	if(tail - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE) > *sq_mask_) return false;
+
+	unsigned index = tail & *sq_mask_;
+	struct io_uring_sqe* sqe = &sqes_[index];
+	memset(sqe, 0, sizeof(*sqe));
+	sqe->opcode = IORING_OP_RECV;
+	sqe->fd = fd_;
+	sqe->flags = IOSQE_BUFFER_SELECT;
+	sqe->ioprio = IORING_RECV_MULTISHOT;
+	sqe->buf_group = URING_BUFFER_GROUP;
+	sqe->user_data = URING_RECEIVE;
+	sq_array_[index] = index;
+	__atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+
+	return syscall(__NR_io_uring_enter, ring_fd_, 1, 0, 0, NULL, 0) >= 0;
+}
+
+int UringReceiver::wait(const data_callback_t& callback) {
+	if(ring_fd_ < 0) return -EBADF;
+	if(closed_) return 0;
+
+	int received = 0;
+	int error = 0;
+	while(received == 0 && !closed_ && error == 0) {
+		unsigned head = *cq_head_;
+		if(head == __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE)) {
+			if(syscall(__NR_io_uring_enter, ring_fd_, 0, 1, IORING_ENTER_GETEVENTS, NULL, 0) < 0) return -errno;
+		}
+
+		bool rearm = false;
+		unsigned tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+		for(; head != tail; head++) {
+			struct io_uring_cqe* cqe = &cqes_[head & *cq_mask_];
+			if(cqe->user_data != URING_RECEIVE) continue;
+
+			if(cqe->res > 0 && (cqe->flags & IORING_CQE_F_BUFFER)) {
+				uint16_t id = (uint16_t) (cqe->flags >> IORING_CQE_BUFFER_SHIFT);
+				callback(&buffers_[(size_t) id * buffer_size_], (size_t) cqe->res);
+				recycleBuffer(id);
+				received += cqe->res;
+			}
+			else if(cqe->res == 0) closed_ = true;
+			else if(cqe->res != -ENOBUFS) error = cqe->res;
+
+			// The kernel ends a multishot receive when it runs out of buffers,
+			// so post it again once the buffers above have been returned.
+			if(!(cqe->flags & IORING_CQE_F_MORE)) rearm = (cqe->res > 0 || cqe->res == -ENOBUFS);
+		}
+		__atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+
+		if(rearm && !closed_ && error == 0 && !postReceive()) error = -EIO;
+	}
+
+	if(received > 0) return received;
+	return closed_ ? 0 : error;
+}
+
+} // namespace adnav
+
+#endif // defined(ADNAV_HAS_IO_URING)
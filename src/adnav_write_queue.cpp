@@ -0,0 +1,149 @@
+/****************************************************************/
+/*                                                              */
+/*                     Advanced Navigation                      */
+/*                        Write Queue                           */
+/*         Copyright 2023, Advanced Navigation Pty Ltd          */
+/*                                                              */
+/****************************************************************/
+/*
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+#include "adnav_write_queue.h"
+
+#include <string.h>
+#include <iostream>
+
+#if defined(__linux__)
+
+namespace adnav {
+
+WriteQueue::WriteQueue(Communicator& communicator, size_t capacity)
+	: communicator_(communicator), capacity_(capacity) {
+	memset(&statistics_, 0, sizeof(statistics_));
+	thread_ = std::thread(&WriteQueue::writer, this);
+}
+
+WriteQueue::~WriteQueue() {
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		stop_ = true;
+	}
+	queued_.notify_one();
+	if(thread_.joinable()) thread_.join();
+}
+
+bool WriteQueue::push(const void* buf, size_t len) {
+	if(len == 0) return true;
+
+	std::lock_guard<std::mutex> lock(mutex_);
+	if(stop_ || statistics_.queued_bytes + len > capacity_) {
+		statistics_.packets_dropped++;
+		return false;
+	}
+
+	// Reuse buffers returned by the writer to avoid allocating per packet.
+	std::vector<uint8_t> buffer;
+	if(!spare_.empty()) {
+		buffer = std::move(spare_.back());
+		spare_.pop_back();
+	}
+	buffer.assign((const uint8_t*) buf, (const uint8_t*) buf + len);
+	queue_.push_back(std::move(buffer));
+
+	statistics_.packets_queued++;
+	statistics_.bytes_queued += len;
+	statistics_.queued_bytes += len;
+	if(statistics_.queued_bytes > statistics_.high_water_bytes) statistics_.high_water_bytes = statistics_.queued_bytes;
+	queued_.notify_one();
+	return true;
+}
+
+void WriteQueue::flush() {
+	std::unique_lock<std::mutex> lock(mutex_);
+	drained_.wait(lock, [this]() { return queue_.empty() && !busy_; });
+}
+
+write_queue_statistics_t WriteQueue::statistics() {
+	write_queue_statistics_t statistics;
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		statistics = statistics_;
+	}
+	statistics.partial_writes = communicator_.partialWrites();
+	statistics.write_stalls = communicator_.writeStalls();
+	return statistics;
+}
+
+void WriteQueue::writer() {
+	struct iovec vectors[WRITE_QUEUE_BATCH];
+	std::unique_lock<std::mutex> lock(mutex_);
+	while(true) {
+		queued_.wait(lock, [this]() { return stop_ || !queue_.empty(); });
+		if(queue_.empty()) break;
+
+		// Coalesce everything waiting, up to one batch, into a single write.
+		writing_.clear();
+		size_t total = 0;
+		while(!queue_.empty() && writing_.size() < (size_t) WRITE_QUEUE_BATCH) {
+			writing_.push_back(std::move(queue_.front()));
+			queue_.pop_front();
+			vectors[writing_.size() - 1].iov_base = writing_.back().data();
+			vectors[writing_.size() - 1].iov_len = writing_.back().size();
+			total += writing_.back().size();
+		}
+		busy_ = true;
+		lock.unlock();
+
+		int written = -1;
+		try {
+			written = communicator_.writeBatch(vectors, (int) writing_.size());
+		}
+		catch(const std::exception& error) {
+			std::cerr << "Write queue error: " << error.what() << std::endl;
+		}
+
+		lock.lock();
+		busy_ = false;
+		statistics_.batches++;
+		statistics_.queued_bytes -= total;
+		if(written > 0) statistics_.bytes_written += written;
+
+		// A write that timed out or failed part way may still have sent the first packets.
+		size_t remaining = (written > 0) ? (size_t) written : 0;
+		size_t complete = 0;
+		while(complete < writing_.size() && remaining >= writing_[complete].size()) {
+			remaining -= writing_[complete].size();
+			complete++;
+		}
+		statistics_.packets_written += complete;
+		if(complete < writing_.size()) statistics_.write_errors++;
+
+		for(auto& buffer : writing_) {
+			if(spare_.size() < (size_t) WRITE_QUEUE_BATCH) spare_.push_back(std::move(buffer));
+		}
+		writing_.clear();
+		if(queue_.empty()) drained_.notify_all();
+	}
+	drained_.notify_all();
+}
+
+} // namespace adnav
+
+#endif // defined(__linux__)
@@ -30,6 +30,225 @@
 
 #include "an_packet_protocol.h"
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define AN_PACKET_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define AN_PACKET_SSE2
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define an_atomic_load64(pointer) (*(pointer))
+#define an_atomic_load32(pointer) (*(pointer))
+#define an_atomic_store32(pointer, value) (*(pointer) = (value))
+#define an_atomic_add64(pointer, value) ((uint64_t) _InterlockedExchangeAdd64((volatile __int64*) (pointer), (__int64) (value)) + (value))
+#define an_atomic_cas64(pointer, expected, desired) (_InterlockedCompareExchange64((volatile __int64*) (pointer), (__int64) (desired), (__int64) (expected)) == (__int64) (expected))
+#else
+#define an_atomic_load64(pointer) __atomic_load_n(pointer, __ATOMIC_ACQUIRE)
+#define an_atomic_load32(pointer) __atomic_load_n(pointer, __ATOMIC_RELAXED)
+#define an_atomic_store32(pointer, value) __atomic_store_n(pointer, value, __ATOMIC_RELAXED)
+#define an_atomic_add64(pointer, value) __atomic_add_fetch(pointer, value, __ATOMIC_RELAXED)
+#define an_atomic_cas64(pointer, expected, desired) __atomic_compare_exchange_n(pointer, &(expected), desired, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+#endif
+
+/*
+ * The free list head holds the index of the first free slab plus one in the
+ * low 32 bits and a modification count in the high 32 bits to avoid ABA
+ */
+struct an_packet_pool_s
+{
+	uint8_t* slabs;
+	volatile uint32_t* next;
+	uint32_t slab_count;
+	volatile uint64_t head;
+	volatile uint64_t in_use;
+	volatile uint64_t high_water_mark;
+	volatile uint64_t allocations;
+	volatile uint64_t fallback_allocations;
+};
+
+static an_packet_pool_t* an_packet_default_pool = NULL;
+
+/*
+ * Slice by 8 tables, crc16_slice_table[k][i] is the CRC16 contribution of byte i
+ * followed by k zero bytes. crc16_slice_table[0] is identical to crc16_table.
+ */
+static const uint16_t crc16_slice_table[8][256] =
+	{
+		{
+			0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50a5, 0x60c6, 0x70e7, 0x8108, 0x9129, 0xa14a, 0xb16b, 0xc18c, 0xd1ad, 0xe1ce, 0xf1ef,
+			0x1231, 0x0210, 0x3273, 0x2252, 0x52b5, 0x4294, 0x72f7, 0x62d6, 0x9339, 0x8318, 0xb37b, 0xa35a, 0xd3bd, 0xc39c, 0xf3ff, 0xe3de,
+			0x2462, 0x3443, 0x0420, 0x1401, 0x64e6, 0x74c7, 0x44a4, 0x5485, 0xa56a, 0xb54b, 0x8528, 0x9509, 0xe5ee, 0xf5cf, 0xc5ac, 0xd58d,
+			0x3653, 0x2672, 0x1611, 0x0630, 0x76d7, 0x66f6, 0x5695, 0x46b4, 0xb75b, 0xa77a, 0x9719, 0x8738, 0xf7df, 0xe7fe, 0xd79d, 0xc7bc,
+			0x48c4, 0x58e5, 0x6886, 0x78a7, 0x0840, 0x1861, 0x2802, 0x3823, 0xc9cc, 0xd9ed, 0xe98e, 0xf9af, 0x8948, 0x9969, 0xa90a, 0xb92b,
+			0x5af5, 0x4ad4, 0x7ab7, 0x6a96, 0x1a71, 0x0a50, 0x3a33, 0x2a12, 0xdbfd, 0xcbdc, 0xfbbf, 0xeb9e, 0x9b79, 0x8b58, 0xbb3b, 0xab1a,
+			0x6ca6, 0x7c87, 0x4ce4, 0x5cc5, 0x2c22, 0x3c03, 0x0c60, 0x1c41, 0xedae, 0xfd8f, 0xcdec, 0xddcd, 0xad2a, 0xbd0b, 0x8d68, 0x9d49,
+			0x7e97, 0x6eb6, 0x5ed5, 0x4ef4, 0x3e13, 0x2e32, 0x1e51, 0x0e70, 0xff9f, 0xefbe, 0xdfdd, 0xcffc, 0xbf1b, 0xaf3a, 0x9f59, 0x8f78,
+			0x9188, 0x81a9, 0xb1ca, 0xa1eb, 0xd10c, 0xc12d, 0xf14e, 0xe16f, 0x1080, 0x00a1, 0x30c2, 0x20e3, 0x5004, 0x4025, 0x7046, 0x6067,
+			0x83b9, 0x9398, 0xa3fb, 0xb3da, 0xc33d, 0xd31c, 0xe37f, 0xf35e, 0x02b1, 0x1290, 0x22f3, 0x32d2, 0x4235, 0x5214, 0x6277, 0x7256,
+			0xb5ea, 0xa5cb, 0x95a8, 0x8589, 0xf56e, 0xe54f, 0xd52c, 0xc50d, 0x34e2, 0x24c3, 0x14a0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
+			0xa7db, 0xb7fa, 0x8799, 0x97b8, 0xe75f, 0xf77e, 0xc71d, 0xd73c, 0x26d3, 0x36f2, 0x0691, 0x16b0, 0x6657, 0x7676, 0x4615, 0x5634,
+			0xd94c, 0xc96d, 0xf90e, 0xe92f, 0x99c8, 0x89e9, 0xb98a, 0xa9ab, 0x5844, 0x4865, 0x7806, 0x6827, 0x18c0, 0x08e1, 0x3882, 0x28a3,
+			0xcb7d, 0xdb5c, 0xeb3f, 0xfb1e, 0x8bf9, 0x9bd8, 0xabbb, 0xbb9a, 0x4a75, 0x5a54, 0x6a37, 0x7a16, 0x0af1, 0x1ad0, 0x2ab3, 0x3a92,
+			0xfd2e, 0xed0f, 0xdd6c, 0xcd4d, 0xbdaa, 0xad8b, 0x9de8, 0x8dc9, 0x7c26, 0x6c07, 0x5c64, 0x4c45, 0x3ca2, 0x2c83, 0x1ce0, 0x0cc1,
+			0xef1f, 0xff3e, 0xcf5d, 0xdf7c, 0xaf9b, 0xbfba, 0x8fd9, 0x9ff8, 0x6e17, 0x7e36, 0x4e55, 0x5e74, 0x2e93, 0x3eb2, 0x0ed1, 0x1ef0
+		},
+		{
+			0x0000, 0x3331, 0x6662, 0x5553, 0xccc4, 0xfff5, 0xaaa6, 0x9997, 0x89a9, 0xba98, 0xefcb, 0xdcfa, 0x456d, 0x765c, 0x230f, 0x103e,
+			0x0373, 0x3042, 0x6511, 0x5620, 0xcfb7, 0xfc86, 0xa9d5, 0x9ae4, 0x8ada, 0xb9eb, 0xecb8, 0xdf89, 0x461e, 0x752f, 0x207c, 0x134d,
+			0x06e6, 0x35d7, 0x6084, 0x53b5, 0xca22, 0xf913, 0xac40, 0x9f71, 0x8f4f, 0xbc7e, 0xe92d, 0xda1c, 0x438b, 0x70ba, 0x25e9, 0x16d8,
+			0x0595, 0x36a4, 0x63f7, 0x50c6, 0xc951, 0xfa60, 0xaf33, 0x9c02, 0x8c3c, 0xbf0d, 0xea5e, 0xd96f, 0x40f8, 0x73c9, 0x269a, 0x15ab,
+			0x0dcc, 0x3efd, 0x6bae, 0x589f, 0xc108, 0xf239, 0xa76a, 0x945b, 0x8465, 0xb754, 0xe207, 0xd136, 0x48a1, 0x7b90, 0x2ec3, 0x1df2,
+			0x0ebf, 0x3d8e, 0x68dd, 0x5bec, 0xc27b, 0xf14a, 0xa419, 0x9728, 0x8716, 0xb427, 0xe174, 0xd245, 0x4bd2, 0x78e3, 0x2db0, 0x1e81,
+			0x0b2a, 0x381b, 0x6d48, 0x5e79, 0xc7ee, 0xf4df, 0xa18c, 0x92bd, 0x8283, 0xb1b2, 0xe4e1, 0xd7d0, 0x4e47, 0x7d76, 0x2825, 0x1b14,
+			0x0859, 0x3b68, 0x6e3b, 0x5d0a, 0xc49d, 0xf7ac, 0xa2ff, 0x91ce, 0x81f0, 0xb2c1, 0xe792, 0xd4a3, 0x4d34, 0x7e05, 0x2b56, 0x1867,
+			0x1b98, 0x28a9, 0x7dfa, 0x4ecb, 0xd75c, 0xe46d, 0xb13e, 0x820f, 0x9231, 0xa100, 0xf453, 0xc762, 0x5ef5, 0x6dc4, 0x3897, 0x0ba6,
+			0x18eb, 0x2bda, 0x7e89, 0x4db8, 0xd42f, 0xe71e, 0xb24d, 0x817c, 0x9142, 0xa273, 0xf720, 0xc411, 0x5d86, 0x6eb7, 0x3be4, 0x08d5,
+			0x1d7e, 0x2e4f, 0x7b1c, 0x482d, 0xd1ba, 0xe28b, 0xb7d8, 0x84e9, 0x94d7, 0xa7e6, 0xf2b5, 0xc184, 0x5813, 0x6b22, 0x3e71, 0x0d40,
+			0x1e0d, 0x2d3c, 0x786f, 0x4b5e, 0xd2c9, 0xe1f8, 0xb4ab, 0x879a, 0x97a4, 0xa495, 0xf1c6, 0xc2f7, 0x5b60, 0x6851, 0x3d02, 0x0e33,
+			0x1654, 0x2565, 0x7036, 0x4307, 0xda90, 0xe9a1, 0xbcf2, 0x8fc3, 0x9ffd, 0xaccc, 0xf99f, 0xcaae, 0x5339, 0x6008, 0x355b, 0x066a,
+			0x1527, 0x2616, 0x7345, 0x4074, 0xd9e3, 0xead2, 0xbf81, 0x8cb0, 0x9c8e, 0xafbf, 0xfaec, 0xc9dd, 0x504a, 0x637b, 0x3628, 0x0519,
+			0x10b2, 0x2383, 0x76d0, 0x45e1, 0xdc76, 0xef47, 0xba14, 0x8925, 0x991b, 0xaa2a, 0xff79, 0xcc48, 0x55df, 0x66ee, 0x33bd, 0x008c,
+			0x13c1, 0x20f0, 0x75a3, 0x4692, 0xdf05, 0xec34, 0xb967, 0x8a56, 0x9a68, 0xa959, 0xfc0a, 0xcf3b, 0x56ac, 0x659d, 0x30ce, 0x03ff
+		},
+		{
+			0x0000, 0x3730, 0x6e60, 0x5950, 0xdcc0, 0xebf0, 0xb2a0, 0x8590, 0xa9a1, 0x9e91, 0xc7c1, 0xf0f1, 0x7561, 0x4251, 0x1b01, 0x2c31,
+			0x4363, 0x7453, 0x2d03, 0x1a33, 0x9fa3, 0xa893, 0xf1c3, 0xc6f3, 0xeac2, 0xddf2, 0x84a2, 0xb392, 0x3602, 0x0132, 0x5862, 0x6f52,
+			0x86c6, 0xb1f6, 0xe8a6, 0xdf96, 0x5a06, 0x6d36, 0x3466, 0x0356, 0x2f67, 0x1857, 0x4107, 0x7637, 0xf3a7, 0xc497, 0x9dc7, 0xaaf7,
+			0xc5a5, 0xf295, 0xabc5, 0x9cf5, 0x1965, 0x2e55, 0x7705, 0x4035, 0x6c04, 0x5b34, 0x0264, 0x3554, 0xb0c4, 0x87f4, 0xdea4, 0xe994,
+			0x1dad, 0x2a9d, 0x73cd, 0x44fd, 0xc16d, 0xf65d, 0xaf0d, 0x983d, 0xb40c, 0x833c, 0xda6c, 0xed5c, 0x68cc, 0x5ffc, 0x06ac, 0x319c,
+			0x5ece, 0x69fe, 0x30ae, 0x079e, 0x820e, 0xb53e, 0xec6e, 0xdb5e, 0xf76f, 0xc05f, 0x990f, 0xae3f, 0x2baf, 0x1c9f, 0x45cf, 0x72ff,
+			0x9b6b, 0xac5b, 0xf50b, 0xc23b, 0x47ab, 0x709b, 0x29cb, 0x1efb, 0x32ca, 0x05fa, 0x5caa, 0x6b9a, 0xee0a, 0xd93a, 0x806a, 0xb75a,
+			0xd808, 0xef38, 0xb668, 0x8158, 0x04c8, 0x33f8, 0x6aa8, 0x5d98, 0x71a9, 0x4699, 0x1fc9, 0x28f9, 0xad69, 0x9a59, 0xc309, 0xf439,
+			0x3b5a, 0x0c6a, 0x553a, 0x620a, 0xe79a, 0xd0aa, 0x89fa, 0xbeca, 0x92fb, 0xa5cb, 0xfc9b, 0xcbab, 0x4e3b, 0x790b, 0x205b, 0x176b,
+			0x7839, 0x4f09, 0x1659, 0x2169, 0xa4f9, 0x93c9, 0xca99, 0xfda9, 0xd198, 0xe6a8, 0xbff8, 0x88c8, 0x0d58, 0x3a68, 0x6338, 0x5408,
+			0xbd9c, 0x8aac, 0xd3fc, 0xe4cc, 0x615c, 0x566c, 0x0f3c, 0x380c, 0x143d, 0x230d, 0x7a5d, 0x4d6d, 0xc8fd, 0xffcd, 0xa69d, 0x91ad,
+			0xfeff, 0xc9cf, 0x909f, 0xa7af, 0x223f, 0x150f, 0x4c5f, 0x7b6f, 0x575e, 0x606e, 0x393e, 0x0e0e, 0x8b9e, 0xbcae, 0xe5fe, 0xd2ce,
+			0x26f7, 0x11c7, 0x4897, 0x7fa7, 0xfa37, 0xcd07, 0x9457, 0xa367, 0x8f56, 0xb866, 0xe136, 0xd606, 0x5396, 0x64a6, 0x3df6, 0x0ac6,
+			0x6594, 0x52a4, 0x0bf4, 0x3cc4, 0xb954, 0x8e64, 0xd734, 0xe004, 0xcc35, 0xfb05, 0xa255, 0x9565, 0x10f5, 0x27c5, 0x7e95, 0x49a5,
+			0xa031, 0x9701, 0xce51, 0xf961, 0x7cf1, 0x4bc1, 0x1291, 0x25a1, 0x0990, 0x3ea0, 0x67f0, 0x50c0, 0xd550, 0xe260, 0xbb30, 0x8c00,
+			0xe352, 0xd462, 0x8d32, 0xba02, 0x3f92, 0x08a2, 0x51f2, 0x66c2, 0x4af3, 0x7dc3, 0x2493, 0x13a3, 0x9633, 0xa103, 0xf853, 0xcf63
+		},
+		{
+			0x0000, 0x76b4, 0xed68, 0x9bdc, 0xcaf1, 0xbc45, 0x2799, 0x512d, 0x85c3, 0xf377, 0x68ab, 0x1e1f, 0x4f32, 0x3986, 0xa25a, 0xd4ee,
+			0x1ba7, 0x6d13, 0xf6cf, 0x807b, 0xd156, 0xa7e2, 0x3c3e, 0x4a8a, 0x9e64, 0xe8d0, 0x730c, 0x05b8, 0x5495, 0x2221, 0xb9fd, 0xcf49,
+			0x374e, 0x41fa, 0xda26, 0xac92, 0xfdbf, 0x8b0b, 0x10d7, 0x6663, 0xb28d, 0xc439, 0x5fe5, 0x2951, 0x787c, 0x0ec8, 0x9514, 0xe3a0,
+			0x2ce9, 0x5a5d, 0xc181, 0xb735, 0xe618, 0x90ac, 0x0b70, 0x7dc4, 0xa92a, 0xdf9e, 0x4442, 0x32f6, 0x63db, 0x156f, 0x8eb3, 0xf807,
+			0x6e9c, 0x1828, 0x83f4, 0xf540, 0xa46d, 0xd2d9, 0x4905, 0x3fb1, 0xeb5f, 0x9deb, 0x0637, 0x7083, 0x21ae, 0x571a, 0xccc6, 0xba72,
+			0x753b, 0x038f, 0x9853, 0xeee7, 0xbfca, 0xc97e, 0x52a2, 0x2416, 0xf0f8, 0x864c, 0x1d90, 0x6b24, 0x3a09, 0x4cbd, 0xd761, 0xa1d5,
+			0x59d2, 0x2f66, 0xb4ba, 0xc20e, 0x9323, 0xe597, 0x7e4b, 0x08ff, 0xdc11, 0xaaa5, 0x3179, 0x47cd, 0x16e0, 0x6054, 0xfb88, 0x8d3c,
+			0x4275, 0x34c1, 0xaf1d, 0xd9a9, 0x8884, 0xfe30, 0x65ec, 0x1358, 0xc7b6, 0xb102, 0x2ade, 0x5c6a, 0x0d47, 0x7bf3, 0xe02f, 0x969b,
+			0xdd38, 0xab8c, 0x3050, 0x46e4, 0x17c9, 0x617d, 0xfaa1, 0x8c15, 0x58fb, 0x2e4f, 0xb593, 0xc327, 0x920a, 0xe4be, 0x7f62, 0x09d6,
+			0xc69f, 0xb02b, 0x2bf7, 0x5d43, 0x0c6e, 0x7ada, 0xe106, 0x97b2, 0x435c, 0x35e8, 0xae34, 0xd880, 0x89ad, 0xff19, 0x64c5, 0x1271,
+			0xea76, 0x9cc2, 0x071e, 0x71aa, 0x2087, 0x5633, 0xcdef, 0xbb5b, 0x6fb5, 0x1901, 0x82dd, 0xf469, 0xa544, 0xd3f0, 0x482c, 0x3e98,
+			0xf1d1, 0x8765, 0x1cb9, 0x6a0d, 0x3b20, 0x4d94, 0xd648, 0xa0fc, 0x7412, 0x02a6, 0x997a, 0xefce, 0xbee3, 0xc857, 0x538b, 0x253f,
+			0xb3a4, 0xc510, 0x5ecc, 0x2878, 0x7955, 0x0fe1, 0x943d, 0xe289, 0x3667, 0x40d3, 0xdb0f, 0xadbb, 0xfc96, 0x8a22, 0x11fe, 0x674a,
+			0xa803, 0xdeb7, 0x456b, 0x33df, 0x62f2, 0x1446, 0x8f9a, 0xf92e, 0x2dc0, 0x5b74, 0xc0a8, 0xb61c, 0xe731, 0x9185, 0x0a59, 0x7ced,
+			0x84ea, 0xf25e, 0x6982, 0x1f36, 0x4e1b, 0x38af, 0xa373, 0xd5c7, 0x0129, 0x779d, 0xec41, 0x9af5, 0xcbd8, 0xbd6c, 0x26b0, 0x5004,
+			0x9f4d, 0xe9f9, 0x7225, 0x0491, 0x55bc, 0x2308, 0xb8d4, 0xce60, 0x1a8e, 0x6c3a, 0xf7e6, 0x8152, 0xd07f, 0xa6cb, 0x3d17, 0x4ba3
+		},
+		{
+			0x0000, 0xaa51, 0x4483, 0xeed2, 0x8906, 0x2357, 0xcd85, 0x67d4, 0x022d, 0xa87c, 0x46ae, 0xecff, 0x8b2b, 0x217a, 0xcfa8, 0x65f9,
+			0x045a, 0xae0b, 0x40d9, 0xea88, 0x8d5c, 0x270d, 0xc9df, 0x638e, 0x0677, 0xac26, 0x42f4, 0xe8a5, 0x8f71, 0x2520, 0xcbf2, 0x61a3,
+			0x08b4, 0xa2e5, 0x4c37, 0xe666, 0x81b2, 0x2be3, 0xc531, 0x6f60, 0x0a99, 0xa0c8, 0x4e1a, 0xe44b, 0x839f, 0x29ce, 0xc71c, 0x6d4d,
+			0x0cee, 0xa6bf, 0x486d, 0xe23c, 0x85e8, 0x2fb9, 0xc16b, 0x6b3a, 0x0ec3, 0xa492, 0x4a40, 0xe011, 0x87c5, 0x2d94, 0xc346, 0x6917,
+			0x1168, 0xbb39, 0x55eb, 0xffba, 0x986e, 0x323f, 0xdced, 0x76bc, 0x1345, 0xb914, 0x57c6, 0xfd97, 0x9a43, 0x3012, 0xdec0, 0x7491,
+			0x1532, 0xbf63, 0x51b1, 0xfbe0, 0x9c34, 0x3665, 0xd8b7, 0x72e6, 0x171f, 0xbd4e, 0x539c, 0xf9cd, 0x9e19, 0x3448, 0xda9a, 0x70cb,
+			0x19dc, 0xb38d, 0x5d5f, 0xf70e, 0x90da, 0x3a8b, 0xd459, 0x7e08, 0x1bf1, 0xb1a0, 0x5f72, 0xf523, 0x92f7, 0x38a6, 0xd674, 0x7c25,
+			0x1d86, 0xb7d7, 0x5905, 0xf354, 0x9480, 0x3ed1, 0xd003, 0x7a52, 0x1fab, 0xb5fa, 0x5b28, 0xf179, 0x96ad, 0x3cfc, 0xd22e, 0x787f,
+			0x22d0, 0x8881, 0x6653, 0xcc02, 0xabd6, 0x0187, 0xef55, 0x4504, 0x20fd, 0x8aac, 0x647e, 0xce2f, 0xa9fb, 0x03aa, 0xed78, 0x4729,
+			0x268a, 0x8cdb, 0x6209, 0xc858, 0xaf8c, 0x05dd, 0xeb0f, 0x415e, 0x24a7, 0x8ef6, 0x6024, 0xca75, 0xada1, 0x07f0, 0xe922, 0x4373,
+			0x2a64, 0x8035, 0x6ee7, 0xc4b6, 0xa362, 0x0933, 0xe7e1, 0x4db0, 0x2849, 0x8218, 0x6cca, 0xc69b, 0xa14f, 0x0b1e, 0xe5cc, 0x4f9d,
+			0x2e3e, 0x846f, 0x6abd, 0xc0ec, 0xa738, 0x0d69, 0xe3bb, 0x49ea, 0x2c13, 0x8642, 0x6890, 0xc2c1, 0xa515, 0x0f44, 0xe196, 0x4bc7,
+			0x33b8, 0x99e9, 0x773b, 0xdd6a, 0xbabe, 0x10ef, 0xfe3d, 0x546c, 0x3195, 0x9bc4, 0x7516, 0xdf47, 0xb893, 0x12c2, 0xfc10, 0x5641,
+			0x37e2, 0x9db3, 0x7361, 0xd930, 0xbee4, 0x14b5, 0xfa67, 0x5036, 0x35cf, 0x9f9e, 0x714c, 0xdb1d, 0xbcc9, 0x1698, 0xf84a, 0x521b,
+			0x3b0c, 0x915d, 0x7f8f, 0xd5de, 0xb20a, 0x185b, 0xf689, 0x5cd8, 0x3921, 0x9370, 0x7da2, 0xd7f3, 0xb027, 0x1a76, 0xf4a4, 0x5ef5,
+			0x3f56, 0x9507, 0x7bd5, 0xd184, 0xb650, 0x1c01, 0xf2d3, 0x5882, 0x3d7b, 0x972a, 0x79f8, 0xd3a9, 0xb47d, 0x1e2c, 0xf0fe, 0x5aaf
+		},
+		{
+			0x0000, 0x45a0, 0x8b40, 0xcee0, 0x06a1, 0x4301, 0x8de1, 0xc841, 0x0d42, 0x48e2, 0x8602, 0xc3a2, 0x0be3, 0x4e43, 0x80a3, 0xc503,
+			0x1a84, 0x5f24, 0x91c4, 0xd464, 0x1c25, 0x5985, 0x9765, 0xd2c5, 0x17c6, 0x5266, 0x9c86, 0xd926, 0x1167, 0x54c7, 0x9a27, 0xdf87,
+			0x3508, 0x70a8, 0xbe48, 0xfbe8, 0x33a9, 0x7609, 0xb8e9, 0xfd49, 0x384a, 0x7dea, 0xb30a, 0xf6aa, 0x3eeb, 0x7b4b, 0xb5ab, 0xf00b,
+			0x2f8c, 0x6a2c, 0xa4cc, 0xe16c, 0x292d, 0x6c8d, 0xa26d, 0xe7cd, 0x22ce, 0x676e, 0xa98e, 0xec2e, 0x246f, 0x61cf, 0xaf2f, 0xea8f,
+			0x6a10, 0x2fb0, 0xe150, 0xa4f0, 0x6cb1, 0x2911, 0xe7f1, 0xa251, 0x6752, 0x22f2, 0xec12, 0xa9b2, 0x61f3, 0x2453, 0xeab3, 0xaf13,
+			0x7094, 0x3534, 0xfbd4, 0xbe74, 0x7635, 0x3395, 0xfd75, 0xb8d5, 0x7dd6, 0x3876, 0xf696, 0xb336, 0x7b77, 0x3ed7, 0xf037, 0xb597,
+			0x5f18, 0x1ab8, 0xd458, 0x91f8, 0x59b9, 0x1c19, 0xd2f9, 0x9759, 0x525a, 0x17fa, 0xd91a, 0x9cba, 0x54fb, 0x115b, 0xdfbb, 0x9a1b,
+			0x459c, 0x003c, 0xcedc, 0x8b7c, 0x433d, 0x069d, 0xc87d, 0x8ddd, 0x48de, 0x0d7e, 0xc39e, 0x863e, 0x4e7f, 0x0bdf, 0xc53f, 0x809f,
+			0xd420, 0x9180, 0x5f60, 0x1ac0, 0xd281, 0x9721, 0x59c1, 0x1c61, 0xd962, 0x9cc2, 0x5222, 0x1782, 0xdfc3, 0x9a63, 0x5483, 0x1123,
+			0xcea4, 0x8b04, 0x45e4, 0x0044, 0xc805, 0x8da5, 0x4345, 0x06e5, 0xc3e6, 0x8646, 0x48a6, 0x0d06, 0xc547, 0x80e7, 0x4e07, 0x0ba7,
+			0xe128, 0xa488, 0x6a68, 0x2fc8, 0xe789, 0xa229, 0x6cc9, 0x2969, 0xec6a, 0xa9ca, 0x672a, 0x228a, 0xeacb, 0xaf6b, 0x618b, 0x242b,
+			0xfbac, 0xbe0c, 0x70ec, 0x354c, 0xfd0d, 0xb8ad, 0x764d, 0x33ed, 0xf6ee, 0xb34e, 0x7dae, 0x380e, 0xf04f, 0xb5ef, 0x7b0f, 0x3eaf,
+			0xbe30, 0xfb90, 0x3570, 0x70d0, 0xb891, 0xfd31, 0x33d1, 0x7671, 0xb372, 0xf6d2, 0x3832, 0x7d92, 0xb5d3, 0xf073, 0x3e93, 0x7b33,
+			0xa4b4, 0xe114, 0x2ff4, 0x6a54, 0xa215, 0xe7b5, 0x2955, 0x6cf5, 0xa9f6, 0xec56, 0x22b6, 0x6716, 0xaf57, 0xeaf7, 0x2417, 0x61b7,
+			0x8b38, 0xce98, 0x0078, 0x45d8, 0x8d99, 0xc839, 0x06d9, 0x4379, 0x867a, 0xc3da, 0x0d3a, 0x489a, 0x80db, 0xc57b, 0x0b9b, 0x4e3b,
+			0x91bc, 0xd41c, 0x1afc, 0x5f5c, 0x971d, 0xd2bd, 0x1c5d, 0x59fd, 0x9cfe, 0xd95e, 0x17be, 0x521e, 0x9a5f, 0xdfff, 0x111f, 0x54bf
+		},
+		{
+			0x0000, 0xb861, 0x60e3, 0xd882, 0xc1c6, 0x79a7, 0xa125, 0x1944, 0x93ad, 0x2bcc, 0xf34e, 0x4b2f, 0x526b, 0xea0a, 0x3288, 0x8ae9,
+			0x377b, 0x8f1a, 0x5798, 0xeff9, 0xf6bd, 0x4edc, 0x965e, 0x2e3f, 0xa4d6, 0x1cb7, 0xc435, 0x7c54, 0x6510, 0xdd71, 0x05f3, 0xbd92,
+			0x6ef6, 0xd697, 0x0e15, 0xb674, 0xaf30, 0x1751, 0xcfd3, 0x77b2, 0xfd5b, 0x453a, 0x9db8, 0x25d9, 0x3c9d, 0x84fc, 0x5c7e, 0xe41f,
+			0x598d, 0xe1ec, 0x396e, 0x810f, 0x984b, 0x202a, 0xf8a8, 0x40c9, 0xca20, 0x7241, 0xaac3, 0x12a2, 0x0be6, 0xb387, 0x6b05, 0xd364,
+			0xddec, 0x658d, 0xbd0f, 0x056e, 0x1c2a, 0xa44b, 0x7cc9, 0xc4a8, 0x4e41, 0xf620, 0x2ea2, 0x96c3, 0x8f87, 0x37e6, 0xef64, 0x5705,
+			0xea97, 0x52f6, 0x8a74, 0x3215, 0x2b51, 0x9330, 0x4bb2, 0xf3d3, 0x793a, 0xc15b, 0x19d9, 0xa1b8, 0xb8fc, 0x009d, 0xd81f, 0x607e,
+			0xb31a, 0x0b7b, 0xd3f9, 0x6b98, 0x72dc, 0xcabd, 0x123f, 0xaa5e, 0x20b7, 0x98d6, 0x4054, 0xf835, 0xe171, 0x5910, 0x8192, 0x39f3,
+			0x8461, 0x3c00, 0xe482, 0x5ce3, 0x45a7, 0xfdc6, 0x2544, 0x9d25, 0x17cc, 0xafad, 0x772f, 0xcf4e, 0xd60a, 0x6e6b, 0xb6e9, 0x0e88,
+			0xabf9, 0x1398, 0xcb1a, 0x737b, 0x6a3f, 0xd25e, 0x0adc, 0xb2bd, 0x3854, 0x8035, 0x58b7, 0xe0d6, 0xf992, 0x41f3, 0x9971, 0x2110,
+			0x9c82, 0x24e3, 0xfc61, 0x4400, 0x5d44, 0xe525, 0x3da7, 0x85c6, 0x0f2f, 0xb74e, 0x6fcc, 0xd7ad, 0xcee9, 0x7688, 0xae0a, 0x166b,
+			0xc50f, 0x7d6e, 0xa5ec, 0x1d8d, 0x04c9, 0xbca8, 0x642a, 0xdc4b, 0x56a2, 0xeec3, 0x3641, 0x8e20, 0x9764, 0x2f05, 0xf787, 0x4fe6,
+			0xf274, 0x4a15, 0x9297, 0x2af6, 0x33b2, 0x8bd3, 0x5351, 0xeb30, 0x61d9, 0xd9b8, 0x013a, 0xb95b, 0xa01f, 0x187e, 0xc0fc, 0x789d,
+			0x7615, 0xce74, 0x16f6, 0xae97, 0xb7d3, 0x0fb2, 0xd730, 0x6f51, 0xe5b8, 0x5dd9, 0x855b, 0x3d3a, 0x247e, 0x9c1f, 0x449d, 0xfcfc,
+			0x416e, 0xf90f, 0x218d, 0x99ec, 0x80a8, 0x38c9, 0xe04b, 0x582a, 0xd2c3, 0x6aa2, 0xb220, 0x0a41, 0x1305, 0xab64, 0x73e6, 0xcb87,
+			0x18e3, 0xa082, 0x7800, 0xc061, 0xd925, 0x6144, 0xb9c6, 0x01a7, 0x8b4e, 0x332f, 0xebad, 0x53cc, 0x4a88, 0xf2e9, 0x2a6b, 0x920a,
+			0x2f98, 0x97f9, 0x4f7b, 0xf71a, 0xee5e, 0x563f, 0x8ebd, 0x36dc, 0xbc35, 0x0454, 0xdcd6, 0x64b7, 0x7df3, 0xc592, 0x1d10, 0xa571
+		},
+		{
+			0x0000, 0x47d3, 0x8fa6, 0xc875, 0x0f6d, 0x48be, 0x80cb, 0xc718, 0x1eda, 0x5909, 0x917c, 0xd6af, 0x11b7, 0x5664, 0x9e11, 0xd9c2,
+			0x3db4, 0x7a67, 0xb212, 0xf5c1, 0x32d9, 0x750a, 0xbd7f, 0xfaac, 0x236e, 0x64bd, 0xacc8, 0xeb1b, 0x2c03, 0x6bd0, 0xa3a5, 0xe476,
+			0x7b68, 0x3cbb, 0xf4ce, 0xb31d, 0x7405, 0x33d6, 0xfba3, 0xbc70, 0x65b2, 0x2261, 0xea14, 0xadc7, 0x6adf, 0x2d0c, 0xe579, 0xa2aa,
+			0x46dc, 0x010f, 0xc97a, 0x8ea9, 0x49b1, 0x0e62, 0xc617, 0x81c4, 0x5806, 0x1fd5, 0xd7a0, 0x9073, 0x576b, 0x10b8, 0xd8cd, 0x9f1e,
+			0xf6d0, 0xb103, 0x7976, 0x3ea5, 0xf9bd, 0xbe6e, 0x761b, 0x31c8, 0xe80a, 0xafd9, 0x67ac, 0x207f, 0xe767, 0xa0b4, 0x68c1, 0x2f12,
+			0xcb64, 0x8cb7, 0x44c2, 0x0311, 0xc409, 0x83da, 0x4baf, 0x0c7c, 0xd5be, 0x926d, 0x5a18, 0x1dcb, 0xdad3, 0x9d00, 0x5575, 0x12a6,
+			0x8db8, 0xca6b, 0x021e, 0x45cd, 0x82d5, 0xc506, 0x0d73, 0x4aa0, 0x9362, 0xd4b1, 0x1cc4, 0x5b17, 0x9c0f, 0xdbdc, 0x13a9, 0x547a,
+			0xb00c, 0xf7df, 0x3faa, 0x7879, 0xbf61, 0xf8b2, 0x30c7, 0x7714, 0xaed6, 0xe905, 0x2170, 0x66a3, 0xa1bb, 0xe668, 0x2e1d, 0x69ce,
+			0xfd81, 0xba52, 0x7227, 0x35f4, 0xf2ec, 0xb53f, 0x7d4a, 0x3a99, 0xe35b, 0xa488, 0x6cfd, 0x2b2e, 0xec36, 0xabe5, 0x6390, 0x2443,
+			0xc035, 0x87e6, 0x4f93, 0x0840, 0xcf58, 0x888b, 0x40fe, 0x072d, 0xdeef, 0x993c, 0x5149, 0x169a, 0xd182, 0x9651, 0x5e24, 0x19f7,
+			0x86e9, 0xc13a, 0x094f, 0x4e9c, 0x8984, 0xce57, 0x0622, 0x41f1, 0x9833, 0xdfe0, 0x1795, 0x5046, 0x975e, 0xd08d, 0x18f8, 0x5f2b,
+			0xbb5d, 0xfc8e, 0x34fb, 0x7328, 0xb430, 0xf3e3, 0x3b96, 0x7c45, 0xa587, 0xe254, 0x2a21, 0x6df2, 0xaaea, 0xed39, 0x254c, 0x629f,
+			0x0b51, 0x4c82, 0x84f7, 0xc324, 0x043c, 0x43ef, 0x8b9a, 0xcc49, 0x158b, 0x5258, 0x9a2d, 0xddfe, 0x1ae6, 0x5d35, 0x9540, 0xd293,
+			0x36e5, 0x7136, 0xb943, 0xfe90, 0x3988, 0x7e5b, 0xb62e, 0xf1fd, 0x283f, 0x6fec, 0xa799, 0xe04a, 0x2752, 0x6081, 0xa8f4, 0xef27,
+			0x7039, 0x37ea, 0xff9f, 0xb84c, 0x7f54, 0x3887, 0xf0f2, 0xb721, 0x6ee3, 0x2930, 0xe145, 0xa696, 0x618e, 0x265d, 0xee28, 0xa9fb,
+			0x4d8d, 0x0a5e, 0xc22b, 0x85f8, 0x42e0, 0x0533, 0xcd46, 0x8a95, 0x5357, 0x1484, 0xdcf1, 0x9b22, 0x5c3a, 0x1be9, 0xd39c, 0x944f
+		}
+	};
+
+/*
+ * Function to continue a CRC16 calculation over further data
+ * Processes 8 bytes per iteration using the slice by 8 tables
+ */
+uint16_t update_crc16(uint16_t crc, const void* data, uint16_t length)
+{
+	const uint8_t* bytes = (const uint8_t*) data;
+	uint16_t i = 0;
+	for(; i + 8 <= length; i += 8)
+	 {
+		crc = crc16_slice_table[7][bytes[i] ^ (crc >> 8)] ^
+			crc16_slice_table[6][bytes[i + 1] ^ (crc & 0xFF)] ^
+			crc16_slice_table[5][bytes[i + 2]] ^
+			crc16_slice_table[4][bytes[i + 3]] ^
+			crc16_slice_table[3][bytes[i + 4]] ^
+			crc16_slice_table[2][bytes[i + 5]] ^
+			crc16_slice_table[1][bytes[i + 6]] ^
+			crc16_slice_table[0][bytes[i + 7]];
+	}
+	for(; i < length; i++)
+	 {
+		crc = (uint16_t) ((crc << 8) ^ crc16_table[(crc >> 8) ^ bytes[i]]);
+	}
+	return crc;
+}
+
 /*
  * Function to calculate the CRC16 of data
  * CRC16-CCITT
@@ -38,13 +257,7 @@
  */
 uint16_t calculate_crc16(const void* data, uint16_t length)
 {
-	uint8_t* bytes = (uint8_t*) data;
-	uint16_t crc = 0xFFFF, i;
-	for(i = 0; i < length; i++)
-	 {
-		crc = (uint16_t) ((crc << 8) ^ crc16_table[(crc >> 8) ^ bytes[i]]);
-	}
-	return crc;
+	return update_crc16(0xFFFF, data, length);
 }
 
 /*
@@ -55,12 +268,81 @@ uint8_t calculate_header_lrc(uint8_t* data)
 	return ((data[0] + data[1] + data[2] + data[3]) ^ 0xFF) + 1;
 }
 
+/*
+ * Function to find the first offset in data that has a valid header LRC
+ * A header is valid when its five bytes sum to zero modulo 256, so the
+ * candidates are tested 16 or 32 offsets at a time where SIMD is available.
+ * Returns the offset of the first candidate, or the number of bytes that
+ * can be discarded if there is no candidate.
+ */
+static uint16_t an_packet_find_header(const uint8_t* data, uint16_t length)
+{
+	uint16_t i = 0;
+	uint8_t sum;
+#if defined(AN_PACKET_AVX2)
+	__m256i header_sum;
+	uint32_t mask;
+	for(; i + (AN_PACKET_HEADER_SIZE - 1) + 32 <= length; i += 32)
+	 {
+		header_sum = _mm256_loadu_si256((const __m256i*) &data[i]);
+		header_sum = _mm256_add_epi8(header_sum, _mm256_loadu_si256((const __m256i*) &data[i + 1]));
+		header_sum = _mm256_add_epi8(header_sum, _mm256_loadu_si256((const __m256i*) &data[i + 2]));
+		header_sum = _mm256_add_epi8(header_sum, _mm256_loadu_si256((const __m256i*) &data[i + 3]));
+		header_sum = _mm256_add_epi8(header_sum, _mm256_loadu_si256((const __m256i*) &data[i + 4]));
+		mask = (uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(header_sum, _mm256_setzero_si256()));
+		if(mask != 0)
+		 {
+			while(!(mask & 1))
+			 {
+				mask >>= 1;
+				i++;
+			}
+			return i;
+		}
+	}
+#elif defined(AN_PACKET_SSE2)
+	__m128i header_sum;
+	uint32_t mask;
+	for(; i + (AN_PACKET_HEADER_SIZE - 1) + 16 <= length; i += 16)
+	 {
+		header_sum = _mm_loadu_si128((const __m128i*) &data[i]);
+		header_sum = _mm_add_epi8(header_sum, _mm_loadu_si128((const __m128i*) &data[i + 1]));
+		header_sum = _mm_add_epi8(header_sum, _mm_loadu_si128((const __m128i*) &data[i + 2]));
+		header_sum = _mm_add_epi8(header_sum, _mm_loadu_si128((const __m128i*) &data[i + 3]));
+		header_sum = _mm_add_epi8(header_sum, _mm_loadu_si128((const __m128i*) &data[i + 4]));
+		mask = (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(header_sum, _mm_setzero_si128()));
+		if(mask != 0)
+		 {
+			while(!(mask & 1))
+			 {
+				mask >>= 1;
+				i++;
+			}
+			return i;
+		}
+	}
+#endif
+	if(i + AN_PACKET_HEADER_SIZE > length) return i;
+
+	/* rolling sum over the remaining offsets */
+	sum = data[i] + data[i + 1] + data[i + 2] + data[i + 3];
+	for(; i + AN_PACKET_HEADER_SIZE <= length; i++)
+	 {
+		sum += data[i + 4];
+		if(sum == 0) return i;
+		sum -= data[i];
+	}
+	return i;
+}
+
 /*
  * Function to dynamically allocate an an_packet
  */
 an_packet_t* an_packet_allocate(uint8_t length, uint8_t id)
 {
-	an_packet_t* an_packet = malloc(sizeof(an_packet_t) + length * sizeof(uint8_t));
+	an_packet_t* an_packet;
+	if(an_packet_default_pool != NULL) return an_packet_pool_allocate(an_packet_default_pool, length, id);
+	an_packet = malloc(sizeof(an_packet_t) + length * sizeof(uint8_t));
 	if(an_packet != NULL)
 	 {
 		an_packet->id = id;
@@ -74,10 +356,161 @@ an_packet_t* an_packet_allocate(uint8_t length, uint8_t id)
  */
 void an_packet_free(an_packet_t** an_packet)
 {
+	if(an_packet_default_pool != NULL)
+	 {
+		an_packet_pool_free(an_packet_default_pool, an_packet);
+		return;
+	}
 	free(*an_packet);
 	*an_packet = NULL;
 }
 
+/*
+ * Function to create a packet pool with slab_count slabs
+ * Returns NULL if the memory could not be allocated
+ */
+an_packet_pool_t* an_packet_pool_create(uint32_t slab_count)
+{
+	an_packet_pool_t* an_packet_pool;
+	uint32_t i;
+
+	if(slab_count == 0) return NULL;
+	an_packet_pool = malloc(sizeof(an_packet_pool_t));
+	if(an_packet_pool == NULL) return NULL;
+	an_packet_pool->slabs = malloc((size_t) slab_count * AN_PACKET_POOL_SLAB_SIZE);
+	an_packet_pool->next = malloc(slab_count * sizeof(uint32_t));
+	if(an_packet_pool->slabs == NULL || an_packet_pool->next == NULL)
+	 {
+		free(an_packet_pool->slabs);
+		free((void*) an_packet_pool->next);
+		free(an_packet_pool);
+		return NULL;
+	}
+
+	for(i = 0; i < slab_count; i++)
+	 {
+		an_packet_pool->next[i] = (i + 1 < slab_count) ? i + 2 : 0;
+	}
+	an_packet_pool->slab_count = slab_count;
+	an_packet_pool->head = 1;
+	an_packet_pool->in_use = 0;
+	an_packet_pool->high_water_mark = 0;
+	an_packet_pool->allocations = 0;
+	an_packet_pool->fallback_allocations = 0;
+	return an_packet_pool;
+}
+
+/*
+ * Function to destroy a packet pool
+ * All packets allocated from the pool must have been freed beforehand
+ */
+void an_packet_pool_destroy(an_packet_pool_t** an_packet_pool)
+{
+	if(*an_packet_pool == NULL) return;
+	if(an_packet_default_pool == *an_packet_pool) an_packet_default_pool = NULL;
+	free((*an_packet_pool)->slabs);
+	free((void*) (*an_packet_pool)->next);
+	free(*an_packet_pool);
+	*an_packet_pool = NULL;
+}
+
+/*
+ * Function to route an_packet_allocate and an_packet_free through a packet pool
+ * Pass NULL to return to malloc. This must be called before packets are
+ * allocated on other threads and not changed while pool packets are in use.
+ */
+void an_packet_pool_install(an_packet_pool_t* an_packet_pool)
+{
+	an_packet_default_pool = an_packet_pool;
+}
+
+/*
+ * Function to allocate an an_packet from a packet pool
+ * Falls back to malloc when there are no free slabs
+ */
+an_packet_t* an_packet_pool_allocate(an_packet_pool_t* an_packet_pool, uint8_t length, uint8_t id)
+{
+	an_packet_t* an_packet = NULL;
+	uint64_t head, new_head, in_use, high_water_mark;
+	uint32_t index;
+
+	head = an_atomic_load64(&an_packet_pool->head);
+	while((index = (uint32_t) head) != 0)
+	 {
+		new_head = (((head >> 32) + 1) << 32) | an_atomic_load32(&an_packet_pool->next[index - 1]);
+		if(an_atomic_cas64(&an_packet_pool->head, head, new_head))
+		 {
+			an_packet = (an_packet_t*) &an_packet_pool->slabs[(size_t) (index - 1) * AN_PACKET_POOL_SLAB_SIZE];
+			break;
+		}
+		head = an_atomic_load64(&an_packet_pool->head);
+	}
+
+	an_atomic_add64(&an_packet_pool->allocations, 1);
+	if(an_packet == NULL)
+	 {
+		an_atomic_add64(&an_packet_pool->fallback_allocations, 1);
+		an_packet = malloc(sizeof(an_packet_t) + length * sizeof(uint8_t));
+		if(an_packet == NULL) return NULL;
+	}
+	else
+	 {
+		in_use = an_atomic_add64(&an_packet_pool->in_use, 1);
+		high_water_mark = an_atomic_load64(&an_packet_pool->high_water_mark);
+		while(in_use > high_water_mark && !an_atomic_cas64(&an_packet_pool->high_water_mark, high_water_mark, in_use))
+		 {
+			high_water_mark = an_atomic_load64(&an_packet_pool->high_water_mark);
+		}
+	}
+
+	an_packet->id = id;
+	an_packet->length = length;
+	return an_packet;
+}
+
+/*
+ * Function to free an an_packet allocated from a packet pool
+ * Packets that were not allocated from the pool are passed to free
+ */
+void an_packet_pool_free(an_packet_pool_t* an_packet_pool, an_packet_t** an_packet)
+{
+	uint8_t* slab = (uint8_t*) *an_packet;
+	uint64_t head, new_head;
+	uint32_t index;
+
+	if(slab == NULL) return;
+	if(slab < an_packet_pool->slabs || slab >= &an_packet_pool->slabs[(size_t) an_packet_pool->slab_count * AN_PACKET_POOL_SLAB_SIZE])
+	 {
+		free(*an_packet);
+		*an_packet = NULL;
+		return;
+	}
+
+	/* release the usage count before the slab becomes available so in_use never exceeds slab_count */
+	an_atomic_add64(&an_packet_pool->in_use, (uint64_t) -1);
+	index = (uint32_t) ((size_t) (slab - an_packet_pool->slabs) / AN_PACKET_POOL_SLAB_SIZE) + 1;
+	do
+	 {
+		head = an_atomic_load64(&an_packet_pool->head);
+		an_atomic_store32(&an_packet_pool->next[index - 1], (uint32_t) head);
+		new_head = (((head >> 32) + 1) << 32) | index;
+	} while(!an_atomic_cas64(&an_packet_pool->head, head, new_head));
+
+	*an_packet = NULL;
+}
+
+/*
+ * Function to read the usage statistics of a packet pool
+ */
+void an_packet_pool_get_statistics(an_packet_pool_t* an_packet_pool, an_packet_pool_statistics_t* statistics)
+{
+	statistics->slab_count = an_packet_pool->slab_count;
+	statistics->in_use = (uint32_t) an_atomic_load64(&an_packet_pool->in_use);
+	statistics->high_water_mark = (uint32_t) an_atomic_load64(&an_packet_pool->high_water_mark);
+	statistics->allocations = an_atomic_load64(&an_packet_pool->allocations);
+	statistics->fallback_allocations = an_atomic_load64(&an_packet_pool->fallback_allocations);
+}
+
 /*
  * Initialise the decoder
  */
@@ -89,51 +522,108 @@ void an_decoder_initialise(an_decoder_t* an_decoder)
 	an_decoder->bytes_discarded = 0;
 	an_decoder->lrc_errors = 0;
 	an_decoder->crc_errors = 0;
+	an_decoder->view_length = 0;
+	an_decoder->timestamp_count = 0;
 }
 
 /*
- * Function to decode an_packets from raw data
- * Returns a pointer to the packet decoded or NULL if no packet was decoded
+ * Function to record the receive time of the bytes about to be appended at offset
+ * When no slot is free the bytes are attributed to the previous timestamp
  */
-an_packet_t* an_packet_decode(an_decoder_t* an_decoder)
+static void an_timestamps_mark(an_decoder_timestamp_t* timestamps, uint8_t* timestamp_count, uint32_t offset, uint64_t timestamp)
 {
-	uint16_t decode_iterator = 0;
-	an_packet_t* an_packet = NULL;
-	uint8_t header_lrc, id, length;
+	if(*timestamp_count > 0 && timestamps[*timestamp_count - 1].offset == offset)
+	 {
+		timestamps[*timestamp_count - 1].timestamp = timestamp;
+	}
+	else if(*timestamp_count < AN_DECODER_TIMESTAMP_COUNT)
+	 {
+		timestamps[*timestamp_count].offset = offset;
+		timestamps[*timestamp_count].timestamp = timestamp;
+		(*timestamp_count)++;
+	}
+}
+
+/*
+ * Function to drop the timestamps that only cover bytes before offset
+ * Offsets are compared as free running so this also works for the ring decoder
+ */
+static void an_timestamps_release(an_decoder_timestamp_t* timestamps, uint8_t* timestamp_count, uint32_t offset)
+{
+	uint8_t first = 0;
+	while(first + 1 < *timestamp_count && (int32_t) (timestamps[first + 1].offset - offset) <= 0) first++;
+	if(first > 0)
+	 {
+		memmove(&timestamps[0], &timestamps[first], (*timestamp_count - first) * sizeof(an_decoder_timestamp_t));
+		*timestamp_count -= first;
+	}
+}
+
+/*
+ * Function to find the receive time of the byte at offset
+ * Returns 0 if no timestamp covers it
+ */
+static uint64_t an_timestamps_find(const an_decoder_timestamp_t* timestamps, uint8_t timestamp_count, uint32_t offset)
+{
+	uint64_t timestamp = 0;
+	uint8_t i;
+	for(i = 0; i < timestamp_count && (int32_t) (timestamps[i].offset - offset) <= 0; i++) timestamp = timestamps[i].timestamp;
+	return timestamp;
+}
+
+/*
+ * Function to record the host receive time of the next bytes appended to the decoder
+ * Call before an_decoder_increment() so that decoded packets carry the time their first byte arrived
+ */
+void an_decoder_mark_timestamp(an_decoder_t* an_decoder, uint64_t timestamp)
+{
+	an_timestamps_mark(an_decoder->timestamps, &an_decoder->timestamp_count, an_decoder->buffer_length, timestamp);
+}
+
+/*
+ * Function to find the next valid packet in the decoder buffer starting at decode_iterator
+ * Returns TRUE with decode_iterator set to the start of the packet header, or FALSE
+ * with decode_iterator set to the first byte that could not yet be decoded
+ */
+static int an_decoder_scan(an_decoder_t* an_decoder, uint16_t* decode_iterator)
+{
+	uint16_t iterator = *decode_iterator;
+	uint16_t skip;
+	uint8_t header_lrc, length;
 	uint16_t crc;
 
-	while(decode_iterator + AN_PACKET_HEADER_SIZE <= an_decoder->buffer_length)
+	while(iterator + AN_PACKET_HEADER_SIZE <= an_decoder->buffer_length)
 	 {
-		header_lrc = an_decoder->buffer[decode_iterator++];
-		if(header_lrc == calculate_header_lrc(&an_decoder->buffer[decode_iterator]))
+		skip = an_packet_find_header(&an_decoder->buffer[iterator], an_decoder->buffer_length - iterator);
+		an_decoder->lrc_errors += skip;
+		an_decoder->bytes_discarded += skip;
+		iterator += skip;
+		if(iterator + AN_PACKET_HEADER_SIZE > an_decoder->buffer_length) break;
+
+		header_lrc = an_decoder->buffer[iterator++];
+		if(header_lrc == calculate_header_lrc(&an_decoder->buffer[iterator]))
 		 {
-			id = an_decoder->buffer[decode_iterator++];
-			length = an_decoder->buffer[decode_iterator++];
-			crc = an_decoder->buffer[decode_iterator++];
-			crc |= an_decoder->buffer[decode_iterator++] << 8;
+			iterator++;
+			length = an_decoder->buffer[iterator++];
+			crc = an_decoder->buffer[iterator++];
+			crc |= an_decoder->buffer[iterator++] << 8;
 
-			if(decode_iterator + length > an_decoder->buffer_length)
+			if(iterator + length > an_decoder->buffer_length)
 			 {
-				decode_iterator -= AN_PACKET_HEADER_SIZE;
+				iterator -= AN_PACKET_HEADER_SIZE;
 				break;
 			}
 
-			if(crc == calculate_crc16(&an_decoder->buffer[decode_iterator], length))
+			if(crc == calculate_crc16(&an_decoder->buffer[iterator], length))
 			 {
-				an_packet = an_packet_allocate(length, id);
-				if(an_packet != NULL)
-				 {
-					memcpy(an_packet->header, &an_decoder->buffer[decode_iterator - AN_PACKET_HEADER_SIZE], AN_PACKET_HEADER_SIZE * sizeof(uint8_t));
-					memcpy(an_packet->data, &an_decoder->buffer[decode_iterator], length * sizeof(uint8_t));
-				}
-				decode_iterator += length;
 				an_decoder->packets_decoded++;
 				an_decoder->bytes_decoded += length + AN_PACKET_HEADER_SIZE;
-				break;
+				*decode_iterator = iterator - AN_PACKET_HEADER_SIZE;
+				return TRUE;
 			}
 			else
 			 {
-				decode_iterator -= (AN_PACKET_HEADER_SIZE - 1);
+				iterator -= (AN_PACKET_HEADER_SIZE - 1);
 				an_decoder->crc_errors++;
 				an_decoder->bytes_discarded++;
 			}
@@ -144,19 +634,300 @@ an_packet_t* an_packet_decode(an_decoder_t* an_decoder)
 			an_decoder->bytes_discarded++;
 		}
 	}
+	*decode_iterator = iterator;
+	return FALSE;
+}
+
+/*
+ * Function to remove the bytes before decode_iterator from the decoder buffer
+ */
+static void an_decoder_discard(an_decoder_t* an_decoder, uint16_t decode_iterator)
+{
+	uint8_t i;
 	if(decode_iterator < an_decoder->buffer_length)
 	 {
 		if(decode_iterator > 0)
 		 {
 			memmove(&an_decoder->buffer[0], &an_decoder->buffer[decode_iterator], (an_decoder->buffer_length - decode_iterator) * sizeof(uint8_t));
 			an_decoder->buffer_length -= decode_iterator;
+			an_timestamps_release(an_decoder->timestamps, &an_decoder->timestamp_count, decode_iterator);
+			for(i = 0; i < an_decoder->timestamp_count; i++)
+			 {
+				if(an_decoder->timestamps[i].offset > decode_iterator) an_decoder->timestamps[i].offset -= decode_iterator;
+				else an_decoder->timestamps[i].offset = 0;
+			}
+		}
+	}
+	else
+	 {
+		an_decoder->buffer_length = 0;
+		an_decoder->timestamp_count = 0;
+	}
+}
+
+/*
+ * Function to decode an_packets from raw data
+ * Returns a pointer to the packet decoded or NULL if no packet was decoded
+ */
+an_packet_t* an_packet_decode(an_decoder_t* an_decoder)
+{
+	uint16_t decode_iterator = an_decoder->view_length;
+	an_packet_t* an_packet = NULL;
+	uint8_t length;
+
+	an_decoder->view_length = 0;
+	if(an_decoder_scan(an_decoder, &decode_iterator))
+	 {
+		length = an_decoder->buffer[decode_iterator + 2];
+		an_packet = an_packet_allocate(length, an_decoder->buffer[decode_iterator + 1]);
+		if(an_packet != NULL)
+		 {
+			memcpy(an_packet->header, &an_decoder->buffer[decode_iterator], AN_PACKET_HEADER_SIZE * sizeof(uint8_t));
+			memcpy(an_packet->data, &an_decoder->buffer[decode_iterator + AN_PACKET_HEADER_SIZE], length * sizeof(uint8_t));
+		}
+		decode_iterator += AN_PACKET_HEADER_SIZE + length;
+	}
+	an_decoder_discard(an_decoder, decode_iterator);
+
+	return an_packet;
+}
+
+/*
+ * Function to decode an_packets from raw data without allocating
+ * Returns TRUE and fills an_packet_view with pointers into the decoder buffer,
+ * or FALSE if no packet was decoded. The view is only valid until the next
+ * decode call on the same decoder.
+ */
+int an_packet_decode_view(an_decoder_t* an_decoder, an_packet_view_t* an_packet_view)
+{
+	uint16_t decode_iterator = an_decoder->view_length;
+
+	an_decoder->view_length = 0;
+	if(an_decoder_scan(an_decoder, &decode_iterator))
+	 {
+		/* move the packet to the front of the buffer and hold it there until the next decode */
+		an_decoder_discard(an_decoder, decode_iterator);
+		an_packet_view->id = an_decoder->buffer[1];
+		an_packet_view->length = an_decoder->buffer[2];
+		an_packet_view->header = &an_decoder->buffer[0];
+		an_packet_view->data = &an_decoder->buffer[AN_PACKET_HEADER_SIZE];
+		an_packet_view->timestamp = an_timestamps_find(an_decoder->timestamps, an_decoder->timestamp_count, 0);
+		an_decoder->view_length = AN_PACKET_HEADER_SIZE + an_packet_view->length;
+		return TRUE;
+	}
+	an_decoder_discard(an_decoder, decode_iterator);
+
+	return FALSE;
+}
+
+/*
+ * Function to decode all complete an_packets in the decoder buffer in one pass
+ * Calls callback with a view of each packet, up to maximum_packets, and returns
+ * the number of packets decoded. The views are only valid for the duration of
+ * the callback, the consumed bytes are removed from the buffer once at the end.
+ */
+int an_packet_decode_batch(an_decoder_t* an_decoder, an_packet_view_callback_t callback, void* context, int maximum_packets)
+{
+	uint16_t decode_iterator = an_decoder->view_length;
+	an_packet_view_t an_packet_view;
+	int packet_count = 0;
+
+	an_decoder->view_length = 0;
+	while(packet_count < maximum_packets && an_decoder_scan(an_decoder, &decode_iterator))
+	 {
+		an_packet_view.id = an_decoder->buffer[decode_iterator + 1];
+		an_packet_view.length = an_decoder->buffer[decode_iterator + 2];
+		an_packet_view.header = &an_decoder->buffer[decode_iterator];
+		an_packet_view.data = &an_decoder->buffer[decode_iterator + AN_PACKET_HEADER_SIZE];
+		an_packet_view.timestamp = an_timestamps_find(an_decoder->timestamps, an_decoder->timestamp_count, decode_iterator);
+		callback(&an_packet_view, context);
+		decode_iterator += AN_PACKET_HEADER_SIZE + an_packet_view.length;
+		packet_count++;
+	}
+	an_decoder_discard(an_decoder, decode_iterator);
+
+	return packet_count;
+}
+
+/*
+ * Function to create a view of an allocated an_packet
+ */
+void an_packet_get_view(an_packet_t* an_packet, an_packet_view_t* an_packet_view)
+{
+	an_packet_view->id = an_packet->id;
+	an_packet_view->length = an_packet->length;
+	an_packet_view->header = an_packet->header;
+	an_packet_view->data = an_packet->data;
+	an_packet_view->timestamp = 0;
+}
+
+/*
+ * Initialise the ring decoder
+ */
+void an_ring_decoder_initialise(an_ring_decoder_t* an_ring_decoder)
+{
+	an_ring_decoder->head = 0;
+	an_ring_decoder->tail = 0;
+	an_ring_decoder->packets_decoded = 0;
+	an_ring_decoder->bytes_decoded = 0;
+	an_ring_decoder->bytes_discarded = 0;
+	an_ring_decoder->lrc_errors = 0;
+	an_ring_decoder->crc_errors = 0;
+	an_ring_decoder->view_length = 0;
+	an_ring_decoder->timestamp_count = 0;
+}
+
+/*
+ * Function to record the host receive time of the next bytes appended to the ring decoder
+ * Call before an_ring_decoder_increment()
+ */
+void an_ring_decoder_mark_timestamp(an_ring_decoder_t* an_ring_decoder, uint64_t timestamp)
+{
+	an_timestamps_mark(an_ring_decoder->timestamps, &an_ring_decoder->timestamp_count, an_ring_decoder->head, timestamp);
+}
+
+/*
+ * Function to find the receive time of the packet at tail
+ */
+static uint64_t an_ring_decoder_timestamp(an_ring_decoder_t* an_ring_decoder)
+{
+	return an_timestamps_find(an_ring_decoder->timestamps, an_ring_decoder->timestamp_count, an_ring_decoder->tail);
+}
+
+/*
+ * Function to copy length bytes starting at ring index out of the ring buffer
+ */
+static void an_ring_decoder_copy(an_ring_decoder_t* an_ring_decoder, uint32_t index, uint8_t* destination, uint16_t length)
+{
+	uint32_t offset = index & AN_RING_DECODE_BUFFER_MASK;
+	uint32_t contiguous = AN_RING_DECODE_BUFFER_SIZE - offset;
+
+	if(length <= contiguous) memcpy(destination, &an_ring_decoder->buffer[offset], length * sizeof(uint8_t));
+	else
+	 {
+		memcpy(destination, &an_ring_decoder->buffer[offset], contiguous * sizeof(uint8_t));
+		memcpy(&destination[contiguous], &an_ring_decoder->buffer[0], (length - contiguous) * sizeof(uint8_t));
+	}
+}
+
+/*
+ * Function to advance tail to the next valid packet in the ring buffer
+ * Returns TRUE if tail is at the start of a complete packet, FALSE if more data is required
+ */
+static int an_ring_decoder_scan(an_ring_decoder_t* an_ring_decoder)
+{
+	uint8_t header[AN_PACKET_HEADER_SIZE];
+	uint32_t offset, contiguous;
+	uint16_t crc, skip;
+	int found = FALSE;
+
+	an_ring_decoder->tail += an_ring_decoder->view_length;
+	an_ring_decoder->view_length = 0;
+
+	while(an_ring_decoder->head - an_ring_decoder->tail >= AN_PACKET_HEADER_SIZE)
+	 {
+		offset = an_ring_decoder->tail & AN_RING_DECODE_BUFFER_MASK;
+		contiguous = AN_RING_DECODE_BUFFER_SIZE - offset;
+		if(contiguous > an_ring_decoder->head - an_ring_decoder->tail) contiguous = an_ring_decoder->head - an_ring_decoder->tail;
+		skip = an_packet_find_header(&an_ring_decoder->buffer[offset], (uint16_t) contiguous);
+		an_ring_decoder->tail += skip;
+		an_ring_decoder->lrc_errors += skip;
+		an_ring_decoder->bytes_discarded += skip;
+		if(an_ring_decoder->head - an_ring_decoder->tail < AN_PACKET_HEADER_SIZE) break;
+
+		an_ring_decoder_copy(an_ring_decoder, an_ring_decoder->tail, header, AN_PACKET_HEADER_SIZE);
+		if(header[0] == calculate_header_lrc(&header[1]))
+		 {
+			if(an_ring_decoder->head - an_ring_decoder->tail < (uint32_t) (AN_PACKET_HEADER_SIZE + header[2])) break;
+
+			offset = (an_ring_decoder->tail + AN_PACKET_HEADER_SIZE) & AN_RING_DECODE_BUFFER_MASK;
+			contiguous = AN_RING_DECODE_BUFFER_SIZE - offset;
+			if(header[2] <= contiguous) crc = calculate_crc16(&an_ring_decoder->buffer[offset], header[2]);
+			else crc = update_crc16(calculate_crc16(&an_ring_decoder->buffer[offset], contiguous), &an_ring_decoder->buffer[0], header[2] - contiguous);
+
+			if(crc == ((header[4] << 8) | header[3]))
+			 {
+				an_ring_decoder->packets_decoded++;
+				an_ring_decoder->bytes_decoded += header[2] + AN_PACKET_HEADER_SIZE;
+				found = TRUE;
+				break;
+			}
+			else
+			 {
+				an_ring_decoder->tail++;
+				an_ring_decoder->crc_errors++;
+				an_ring_decoder->bytes_discarded++;
+			}
+		}
+		else
+		 {
+			an_ring_decoder->tail++;
+			an_ring_decoder->lrc_errors++;
+			an_ring_decoder->bytes_discarded++;
 		}
 	}
-	else an_decoder->buffer_length = 0;
 
+	/* free the timestamps of everything tail has passed, decoded or discarded, so garbage cannot use up the slots */
+	an_timestamps_release(an_ring_decoder->timestamps, &an_ring_decoder->timestamp_count, an_ring_decoder->tail);
+	return found;
+}
+
+/*
+ * Function to decode an_packets from a ring decoder
+ * Returns a pointer to the packet decoded or NULL if no packet was decoded
+ */
+an_packet_t* an_ring_packet_decode(an_ring_decoder_t* an_ring_decoder)
+{
+	an_packet_t* an_packet = NULL;
+	uint8_t id, length;
+
+	if(an_ring_decoder_scan(an_ring_decoder))
+	 {
+		id = an_ring_decoder->buffer[(an_ring_decoder->tail + 1) & AN_RING_DECODE_BUFFER_MASK];
+		length = an_ring_decoder->buffer[(an_ring_decoder->tail + 2) & AN_RING_DECODE_BUFFER_MASK];
+		an_packet = an_packet_allocate(length, id);
+		if(an_packet != NULL)
+		 {
+			an_ring_decoder_copy(an_ring_decoder, an_ring_decoder->tail, an_packet->header, AN_PACKET_HEADER_SIZE);
+			an_ring_decoder_copy(an_ring_decoder, an_ring_decoder->tail + AN_PACKET_HEADER_SIZE, an_packet->data, length);
+		}
+		an_ring_decoder->tail += AN_PACKET_HEADER_SIZE + length;
+	}
 	return an_packet;
 }
 
+/*
+ * Function to decode an_packets from a ring decoder without allocating
+ * Returns TRUE and fills an_packet_view, or FALSE if no packet was decoded.
+ * Packets that wrap around the end of the ring are copied into a contiguous
+ * area of the decoder. The view is only valid until the next decode call.
+ */
+int an_ring_packet_decode_view(an_ring_decoder_t* an_ring_decoder, an_packet_view_t* an_packet_view)
+{
+	uint32_t offset;
+
+	if(an_ring_decoder_scan(an_ring_decoder))
+	 {
+		offset = an_ring_decoder->tail & AN_RING_DECODE_BUFFER_MASK;
+		an_packet_view->id = an_ring_decoder->buffer[(an_ring_decoder->tail + 1) & AN_RING_DECODE_BUFFER_MASK];
+		an_packet_view->length = an_ring_decoder->buffer[(an_ring_decoder->tail + 2) & AN_RING_DECODE_BUFFER_MASK];
+		an_ring_decoder->view_length = AN_PACKET_HEADER_SIZE + an_packet_view->length;
+		if(offset + an_ring_decoder->view_length <= AN_RING_DECODE_BUFFER_SIZE)
+		 {
+			an_packet_view->header = &an_ring_decoder->buffer[offset];
+		}
+		else
+		 {
+			an_ring_decoder_copy(an_ring_decoder, an_ring_decoder->tail, an_ring_decoder->packet, an_ring_decoder->view_length);
+			an_packet_view->header = an_ring_decoder->packet;
+		}
+		an_packet_view->data = &an_packet_view->header[AN_PACKET_HEADER_SIZE];
+		an_packet_view->timestamp = an_ring_decoder_timestamp(an_ring_decoder);
+		return TRUE;
+	}
+	return FALSE;
+}
+
 /*
  * Function to encode an an_packet
  */
@@ -169,3 +940,32 @@ void an_packet_encode(an_packet_t* an_packet)
 	memcpy(&an_packet->header[3], &crc, sizeof(uint16_t));
 	an_packet->header[0] = calculate_header_lrc(&an_packet->header[1]);
 }
+
+/*
+ * Function to lay out an an_packet view directly in a caller supplied buffer
+ * The header is placed at the start of buffer followed by length bytes of data
+ * Returns FALSE if the packet is too large for the buffer or the protocol
+ */
+int an_packet_view_initialise(an_packet_view_t* an_packet_view, uint8_t* buffer, size_t capacity, size_t length, uint8_t id)
+{
+	if(length > AN_MAXIMUM_PACKET_SIZE || capacity < AN_PACKET_HEADER_SIZE + length) return FALSE;
+	an_packet_view->id = id;
+	an_packet_view->length = (uint8_t) length;
+	an_packet_view->header = buffer;
+	an_packet_view->data = &buffer[AN_PACKET_HEADER_SIZE];
+	an_packet_view->timestamp = 0;
+	return TRUE;
+}
+
+/*
+ * Function to encode an an_packet view in place
+ */
+void an_packet_view_encode(an_packet_view_t* an_packet_view)
+{
+	uint16_t crc;
+	an_packet_view->header[1] = an_packet_view->id;
+	an_packet_view->header[2] = an_packet_view->length;
+	crc = calculate_crc16(an_packet_view->data, an_packet_view->length);
+	memcpy(&an_packet_view->header[3], &crc, sizeof(uint16_t));
+	an_packet_view->header[0] = calculate_header_lrc(&an_packet_view->header[1]);
+}
@@ -47,6 +47,19 @@
  * decode_acknowledge_packet(&acknowledge_packet, &an_packet);
  * printf("acknowledge id %d with result %d\n", acknowledge_packet.packet_id, acknowledge_packet.acknowledge_result);
  *
+ * Each decode function also has a _view variant that reads directly from
+ * the decoder buffer through an an_packet_view_t, avoiding any allocation.
+ *
+ * Example decode without allocation
+ *
+ * an_packet_view_t an_packet_view;
+ * system_state_packet_t system_state_packet;
+ * ...
+ * while(an_packet_decode_view(&an_decoder, &an_packet_view))
+ * {
+ *     if(an_packet_view.id == packet_id_system_state) decode_system_state_packet_view(&system_state_packet, &an_packet_view);
+ * }
+ *
  * Encode functions take a type specific structure and turn it into an
  * an_packet_t. Encode functions are used when sending packets. Don't
  * forget to free the returned packet with an_packet_free().
@@ -61,9 +74,23 @@
  * serial_port_transmit(an_packet_pointer(an_packet), an_packet_size(an_packet));
  * an_packet_free(&an_packet);
  *
+ * Each encode function also has an _into variant that writes the complete
+ * encoded packet, including the header LRC and CRC, into a caller supplied
+ * buffer. These return the number of bytes written, or 0 if the buffer is
+ * too small, and don't allocate.
+ *
+ * Example encode without allocation
+ *
+ * uint8_t buffer[AN_PACKET_HEADER_SIZE + AN_MAXIMUM_PACKET_SIZE];
+ * external_velocity_packet_t external_velocity_packet;
+ * int size;
+ * ...
+ * size = encode_external_velocity_packet_into(buffer, sizeof(buffer), &external_velocity_packet);
+ * serial_port_transmit(buffer, size);
+ *
  */
 
-int decode_acknowledge_packet(acknowledge_packet_t* acknowledge_packet, an_packet_t* an_packet)
+int decode_acknowledge_packet_view(acknowledge_packet_t* acknowledge_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_acknowledge && an_packet->length == 4)
 	 {
@@ -75,14 +102,23 @@ int decode_acknowledge_packet(acknowledge_packet_t* acknowledge_packet, an_packe
 	else return 1;
 }
 
+int encode_request_packet_into(uint8_t* buffer, size_t capacity, uint8_t requested_packet_id)
+{
+	an_packet_view_t an_packet;
+	if(!an_packet_view_initialise(&an_packet, buffer, capacity, 1, packet_id_request)) return 0;
+	an_packet.data[0] = requested_packet_id;
+	an_packet_view_encode(&an_packet);
+	return AN_PACKET_HEADER_SIZE + an_packet.length;
+}
+
 an_packet_t* encode_request_packet(uint8_t requested_packet_id)
 {
 	an_packet_t* an_packet = an_packet_allocate(1, packet_id_request);
-	an_packet->data[0] = requested_packet_id;
+	if(an_packet != NULL) encode_request_packet_into(an_packet->header, AN_PACKET_HEADER_SIZE + an_packet->length, requested_packet_id);
 	return an_packet;
 }
 
-int decode_boot_mode_packet(boot_mode_packet_t* boot_mode_packet, an_packet_t* an_packet)
+int decode_boot_mode_packet_view(boot_mode_packet_t* boot_mode_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_boot_mode && an_packet->length == 1)
 	 {
@@ -92,14 +128,23 @@ int decode_boot_mode_packet(boot_mode_packet_t* boot_mode_packet, an_packet_t* a
 	else return 1;
 }
 
+int encode_boot_mode_packet_into(uint8_t* buffer, size_t capacity, boot_mode_packet_t* boot_mode_packet)
+{
+	an_packet_view_t an_packet;
+	if(!an_packet_view_initialise(&an_packet, buffer, capacity, 1, packet_id_boot_mode)) return 0;
+	an_packet.data[0] = boot_mode_packet->boot_mode;
+	an_packet_view_encode(&an_packet);
+	return AN_PACKET_HEADER_SIZE + an_packet.length;
+}
+
 an_packet_t* encode_boot_mode_packet(boot_mode_packet_t* boot_mode_packet)
 {
 	an_packet_t* an_packet = an_packet_allocate(1, packet_id_boot_mode);
-	an_packet->data[0] = boot_mode_packet->boot_mode;
+	if(an_packet != NULL) encode_boot_mode_packet_into(an_packet->header, AN_PACKET_HEADER_SIZE + an_packet->length, boot_mode_packet);
 	return an_packet;
 }
 
-int decode_device_information_packet(device_information_packet_t* device_information_packet, an_packet_t* an_packet)
+int decode_device_information_packet_view(device_information_packet_t* device_information_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_device_information && an_packet->length == 24)
 	 {
@@ -112,39 +157,63 @@ int decode_device_information_packet(device_information_packet_t* device_informa
 	else return 1;
 }
 
-an_packet_t* encode_restore_factory_settings_packet()
+int encode_restore_factory_settings_packet_into(uint8_t* buffer, size_t capacity)
 {
 	uint32_t verification = 0x85429E1C;
+	an_packet_view_t an_packet;
+	if(!an_packet_view_initialise(&an_packet, buffer, capacity, 4, packet_id_restore_factory_settings)) return 0;
+	memcpy(&an_packet.data[0], &verification, sizeof(uint32_t));
+	an_packet_view_encode(&an_packet);
+	return AN_PACKET_HEADER_SIZE + an_packet.length;
+}
+
+an_packet_t* encode_restore_factory_settings_packet()
+{
 	an_packet_t* an_packet = an_packet_allocate(4, packet_id_restore_factory_settings);
-	memcpy(&an_packet->data[0], &verification, sizeof(uint32_t));
+	if(an_packet != NULL) encode_restore_factory_settings_packet_into(an_packet->header, AN_PACKET_HEADER_SIZE + an_packet->length);
 	return an_packet;
 }
 
-an_packet_t* encode_reset_packet()
+int encode_reset_packet_into(uint8_t* buffer, size_t capacity)
 {
 	uint32_t verification = 0x21057A7E;
+	an_packet_view_t an_packet;
+	if(!an_packet_view_initialise(&an_packet, buffer, capacity, 4, packet_id_reset)) return 0;
+	memcpy(&an_packet.data[0], &verification, sizeof(uint32_t));
+	an_packet_view_encode(&an_packet);
+	return AN_PACKET_HEADER_SIZE + an_packet.length;
+}
+
+an_packet_t* encode_reset_packet()
+{
 	an_packet_t* an_packet = an_packet_allocate(4, packet_id_reset);
-	memcpy(&an_packet->data[0], &verification, sizeof(uint32_t));
+	if(an_packet != NULL) encode_reset_packet_into(an_packet->header, AN_PACKET_HEADER_SIZE + an_packet->length);
 	return an_packet;
 }
 
+int encode_file_transfer_request_packet_into(uint8_t* buffer, size_t capacity, file_transfer_first_packet_t* file_transfer_first_packet, int metadata_size, int data_size)
+{
+	an_packet_view_t an_packet;
+	if(!an_packet_view_initialise(&an_packet, buffer, capacity, 3 * sizeof(uint32_t) + 2 * sizeof(uint8_t) + metadata_size + data_size, packet_id_file_transfer_request)) return 0;
+	memcpy(&an_packet.data[0], &file_transfer_first_packet->unique_id, sizeof(uint32_t));
+	memcpy(&an_packet.data[4], &file_transfer_first_packet->data_index, sizeof(uint32_t));
+	memcpy(&an_packet.data[8], &file_transfer_first_packet->total_size, sizeof(uint32_t));
+	an_packet.data[12] = file_transfer_first_packet->data_encoding;
+	an_packet.data[13] = file_transfer_first_packet->metadata_type;
+	memcpy(&an_packet.data[14], &file_transfer_first_packet->metadata, metadata_size);
+	memcpy(&an_packet.data[14 + metadata_size], &file_transfer_first_packet->packet_data, data_size);
+	an_packet_view_encode(&an_packet);
+	return AN_PACKET_HEADER_SIZE + an_packet.length;
+}
+
 an_packet_t* encode_file_transfer_request_packet(file_transfer_first_packet_t* file_transfer_first_packet, int metadata_size, int data_size)
 {
 	an_packet_t* an_packet = an_packet_allocate(3 * sizeof(uint32_t) + 2 * sizeof(uint8_t) + metadata_size + data_size, packet_id_file_transfer_request);
-	if(an_packet != NULL)
-	 {
-		memcpy(&an_packet->data[0], &file_transfer_first_packet->unique_id, sizeof(uint32_t));
-		memcpy(&an_packet->data[4], &file_transfer_first_packet->data_index, sizeof(uint32_t));
-		memcpy(&an_packet->data[8], &file_transfer_first_packet->total_size, sizeof(uint32_t));
-		an_packet->data[12] = file_transfer_first_packet->data_encoding;
-		an_packet->data[13] = file_transfer_first_packet->metadata_type;
-		memcpy(&an_packet->data[14], &file_transfer_first_packet->metadata, metadata_size);
-		memcpy(&an_packet->data[14 + metadata_size], &file_transfer_first_packet->packet_data, data_size);
-	}
+	if(an_packet != NULL) encode_file_transfer_request_packet_into(an_packet->header, AN_PACKET_HEADER_SIZE + an_packet->length, file_transfer_first_packet, metadata_size, data_size);
 	return an_packet;
 }
 
-int decode_file_transfer_acknowledge_packet(file_transfer_acknowledge_packet_t* file_transfer_acknowledge_packet, an_packet_t* an_packet)
+int decode_file_transfer_acknowledge_packet_view(file_transfer_acknowledge_packet_t* file_transfer_acknowledge_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_file_transfer_acknowledge && an_packet->length == 9)
 	 {
@@ -156,19 +225,25 @@ int decode_file_transfer_acknowledge_packet(file_transfer_acknowledge_packet_t*
 	else return 1;
 }
 
+int encode_file_transfer_packet_into(uint8_t* buffer, size_t capacity, file_transfer_ongoing_packet_t* file_transfer_ongoing_packet, int data_size)
+{
+	an_packet_view_t an_packet;
+	if(!an_packet_view_initialise(&an_packet, buffer, capacity, 2 * sizeof(uint32_t) + data_size, packet_id_file_transfer_request)) return 0;
+	memcpy(&an_packet.data[0], &file_transfer_ongoing_packet->unique_id, sizeof(uint32_t));
+	memcpy(&an_packet.data[4], &file_transfer_ongoing_packet->data_index, sizeof(uint32_t));
+	memcpy(&an_packet.data[8], &file_transfer_ongoing_packet->packet_data, data_size);
+	an_packet_view_encode(&an_packet);
+	return AN_PACKET_HEADER_SIZE + an_packet.length;
+}
+
 an_packet_t* encode_file_transfer_packet(file_transfer_ongoing_packet_t* file_transfer_ongoing_packet, int data_size)
 {
 	an_packet_t* an_packet = an_packet_allocate(2 * sizeof(uint32_t) + data_size, packet_id_file_transfer_request);
-	if(an_packet != NULL)
-	 {
-		memcpy(&an_packet->data[0], &file_transfer_ongoing_packet->unique_id, sizeof(uint32_t));
-		memcpy(&an_packet->data[4], &file_transfer_ongoing_packet->data_index, sizeof(uint32_t));
-		memcpy(&an_packet->data[8], &file_transfer_ongoing_packet->packet_data, data_size);
-	}
+	if(an_packet != NULL) encode_file_transfer_packet_into(an_packet->header, AN_PACKET_HEADER_SIZE + an_packet->length, file_transfer_ongoing_packet, data_size);
 	return an_packet;
 }
 
-int decode_serial_port_passthrough_packet(serial_port_passthrough_packet_t* serial_port_passthrough_packet, an_packet_t* an_packet)
+int decode_serial_port_passthrough_packet_view(serial_port_passthrough_packet_t* serial_port_passthrough_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_serial_port_passthrough)
 	 {
@@ -179,18 +254,24 @@ int decode_serial_port_passthrough_packet(serial_port_passthrough_packet_t* seri
 	else return 1;
 }
 
+int encode_serial_port_passthrough_packet_into(uint8_t* buffer, size_t capacity, serial_port_passthrough_packet_t* serial_port_passthrough_packet, int data_size)
+{
+	an_packet_view_t an_packet;
+	if(!an_packet_view_initialise(&an_packet, buffer, capacity, sizeof(uint8_t) + data_size, packet_id_serial_port_passthrough)) return 0;
+	an_packet.data[0] = serial_port_passthrough_packet->passthrough_route;
+	memcpy(&an_packet.data[1], &serial_port_passthrough_packet->passthrough_data, data_size);
+	an_packet_view_encode(&an_packet);
+	return AN_PACKET_HEADER_SIZE + an_packet.length;
+}
+
 an_packet_t* encode_serial_port_passthrough_packet(serial_port_passthrough_packet_t* serial_port_passthrough_packet, int data_size)
 {
 	an_packet_t* an_packet = an_packet_allocate(sizeof(uint8_t) + data_size, packet_id_serial_port_passthrough);
-	if(an_packet != NULL)
-	 {
-		an_packet->data[0] = serial_port_passthrough_packet->passthrough_route;
-		memcpy(&an_packet->data[1], &serial_port_passthrough_packet->passthrough_data, data_size);
-	}
+	if(an_packet != NULL) encode_serial_port_passthrough_packet_into(an_packet->header, AN_PACKET_HEADER_SIZE + an_packet->length, serial_port_passthrough_packet, data_size);
 	return an_packet;
 }
 
-int decode_ip_configuration_packet(ip_configuration_packet_t* ip_configuration_packet, an_packet_t* an_packet)
+int decode_ip_configuration_packet_view(ip_configuration_packet_t* ip_configuration_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_ip_configuration && an_packet->length == 30)
 	 {
@@ -206,23 +287,29 @@ int decode_ip_configuration_packet(ip_configuration_packet_t* ip_configuration_p
 	else return 1;
 }
 
+int encode_ip_configuration_packet_into(uint8_t* buffer, size_t capacity, ip_configuration_packet_t* ip_configuration_packet)
+{
+	an_packet_view_t an_packet;
+	if(!an_packet_view_initialise(&an_packet, buffer, capacity, 30, packet_id_ip_configuration)) return 0;
+	an_packet.data[0] = ip_configuration_packet->permanent;
+	memcpy(&an_packet.data[1], &ip_configuration_packet->dhcp_mode, sizeof(uint8_t));
+	memcpy(&an_packet.data[2], &ip_configuration_packet->ip_address, sizeof(uint32_t));
+	memcpy(&an_packet.data[6], &ip_configuration_packet->ip_netmask, sizeof(uint32_t));
+	memcpy(&an_packet.data[10], &ip_configuration_packet->ip_gateway, sizeof(uint32_t));
+	memcpy(&an_packet.data[14], &ip_configuration_packet->dns_server, sizeof(uint32_t));
+	memcpy(&an_packet.data[18], &ip_configuration_packet->serial_number[0], 3 * sizeof(uint32_t));
+	an_packet_view_encode(&an_packet);
+	return AN_PACKET_HEADER_SIZE + an_packet.length;
+}
+
 an_packet_t* encode_ip_configuration_packet(ip_configuration_packet_t* ip_configuration_packet)
 {
 	an_packet_t* an_packet = an_packet_allocate(30, packet_id_ip_configuration);
-	if(an_packet != NULL)
-	 {
-		an_packet->data[0] = ip_configuration_packet->permanent;
-		memcpy(&an_packet->data[1], &ip_configuration_packet->dhcp_mode, sizeof(uint8_t));
-		memcpy(&an_packet->data[2], &ip_configuration_packet->ip_address, sizeof(uint32_t));
-		memcpy(&an_packet->data[6], &ip_configuration_packet->ip_netmask, sizeof(uint32_t));
-		memcpy(&an_packet->data[10], &ip_configuration_packet->ip_gateway, sizeof(uint32_t));
-		memcpy(&an_packet->data[14], &ip_configuration_packet->dns_server, sizeof(uint32_t));
-		memcpy(&an_packet->data[18], &ip_configuration_packet->serial_number[0], 3 * sizeof(uint32_t));
-	}
+	if(an_packet != NULL) encode_ip_configuration_packet_into(an_packet->header, AN_PACKET_HEADER_SIZE + an_packet->length, ip_configuration_packet);
 	return an_packet;
 }
 
-int decode_subcomponent_information_packet(subcomponent_information_packet_t* subcomponent_information_packet, an_packet_t* an_packet)
+int decode_subcomponent_information_packet_view(subcomponent_information_packet_t* subcomponent_information_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_subcomponent_information && an_packet->length % 24 == 0)
 	 {
@@ -244,7 +331,7 @@ int decode_subcomponent_information_packet(subcomponent_information_packet_t* su
 	else return 1;
 }
 
-int decode_system_state_packet(system_state_packet_t* system_state_packet, an_packet_t* an_packet)
+int decode_system_state_packet_view(system_state_packet_t* system_state_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_system_state && an_packet->length == 100)
 	 {
@@ -266,7 +353,7 @@ int decode_system_state_packet(system_state_packet_t* system_state_packet, an_pa
 	else return 1;
 }
 
-int decode_unix_time_packet(unix_time_packet_t* unix_time_packet, an_packet_t* an_packet)
+int decode_unix_time_packet_view(unix_time_packet_t* unix_time_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_unix_time && an_packet->length == 8)
 	 {
@@ -277,7 +364,7 @@ int decode_unix_time_packet(unix_time_packet_t* unix_time_packet, an_packet_t* a
 	else return 1;
 }
 
-int decode_formatted_time_packet(formatted_time_packet_t* formatted_time_packet, an_packet_t* an_packet)
+int decode_formatted_time_packet_view(formatted_time_packet_t* formatted_time_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_formatted_time && an_packet->length == 14)
 	 {
@@ -295,7 +382,7 @@ int decode_formatted_time_packet(formatted_time_packet_t* formatted_time_packet,
 	else return 1;
 }
 
-int decode_status_packet(status_packet_t* status_packet, an_packet_t* an_packet)
+int decode_status_packet_view(status_packet_t* status_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_status && an_packet->length == 4)
 	 {
@@ -306,7 +393,7 @@ int decode_status_packet(status_packet_t* status_packet, an_packet_t* an_packet)
 	else return 1;
 }
 
-int decode_position_standard_deviation_packet(position_standard_deviation_packet_t* position_standard_deviation_packet, an_packet_t* an_packet)
+int decode_position_standard_deviation_packet_view(position_standard_deviation_packet_t* position_standard_deviation_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_position_standard_deviation && an_packet->length == 12)
 	 {
@@ -316,7 +403,7 @@ int decode_position_standard_deviation_packet(position_standard_deviation_packet
 	else return 1;
 }
 
-int decode_velocity_standard_deviation_packet(velocity_standard_deviation_packet_t* velocity_standard_deviation_packet, an_packet_t* an_packet)
+int decode_velocity_standard_deviation_packet_view(velocity_standard_deviation_packet_t* velocity_standard_deviation_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_velocity_standard_deviation && an_packet->length == 12)
 	 {
@@ -326,7 +413,7 @@ int decode_velocity_standard_deviation_packet(velocity_standard_deviation_packet
 	else return 1;
 }
 
-int decode_euler_orientation_standard_deviation_packet(euler_orientation_standard_deviation_packet_t* euler_orientation_standard_deviation, an_packet_t* an_packet)
+int decode_euler_orientation_standard_deviation_packet_view(euler_orientation_standard_deviation_packet_t* euler_orientation_standard_deviation, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_euler_orientation_standard_deviation && an_packet->length == 12)
 	 {
@@ -336,7 +423,7 @@ int decode_euler_orientation_standard_deviation_packet(euler_orientation_standar
 	else return 1;
 }
 
-int decode_quaternion_orientation_standard_deviation_packet(quaternion_orientation_standard_deviation_packet_t* quaternion_orientation_standard_deviation_packet, an_packet_t* an_packet)
+int decode_quaternion_orientation_standard_deviation_packet_view(quaternion_orientation_standard_deviation_packet_t* quaternion_orientation_standard_deviation_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_quaternion_orientation_standard_deviation && an_packet->length == 16)
 	 {
@@ -346,7 +433,7 @@ int decode_quaternion_orientation_standard_deviation_packet(quaternion_orientati
 	else return 1;
 }
 
-int decode_raw_sensors_packet(raw_sensors_packet_t* raw_sensors_packet, an_packet_t* an_packet)
+int decode_raw_sensors_packet_view(raw_sensors_packet_t* raw_sensors_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_raw_sensors && an_packet->length == 48)
 	 {
@@ -361,7 +448,7 @@ int decode_raw_sensors_packet(raw_sensors_packet_t* raw_sensors_packet, an_packe
 	else return 1;
 }
 
-int decode_raw_gnss_packet(raw_gnss_packet_t* raw_gnss_packet, an_packet_t* an_packet)
+int decode_raw_gnss_packet_view(raw_gnss_packet_t* raw_gnss_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_raw_gnss && an_packet->length == 74)
 	 {
@@ -380,26 +467,32 @@ int decode_raw_gnss_packet(raw_gnss_packet_t* raw_gnss_packet, an_packet_t* an_p
 	else return 1;
 }
 
+int encode_raw_gnss_packet_into(uint8_t* buffer, size_t capacity, raw_gnss_packet_t* raw_gnss_packet)
+{
+	an_packet_view_t an_packet;
+	if(!an_packet_view_initialise(&an_packet, buffer, capacity, 74, packet_id_raw_gnss)) return 0;
+	memcpy(&an_packet.data[0], &raw_gnss_packet->unix_time_seconds, sizeof(uint32_t));
+	memcpy(&an_packet.data[4], &raw_gnss_packet->microseconds, sizeof(uint32_t));
+	memcpy(&an_packet.data[8], &raw_gnss_packet->position[0], 3 * sizeof(double));
+	memcpy(&an_packet.data[32], &raw_gnss_packet->velocity[0], 3 * sizeof(float));
+	memcpy(&an_packet.data[44], &raw_gnss_packet->position_standard_deviation[0], 3 * sizeof(float));
+	memcpy(&an_packet.data[56], &raw_gnss_packet->tilt, sizeof(float));
+	memcpy(&an_packet.data[60], &raw_gnss_packet->heading, sizeof(float));
+	memcpy(&an_packet.data[64], &raw_gnss_packet->tilt_standard_deviation, sizeof(float));
+	memcpy(&an_packet.data[68], &raw_gnss_packet->heading_standard_deviation, sizeof(float));
+	memcpy(&an_packet.data[72], &raw_gnss_packet->flags.r, sizeof(uint16_t));
+	an_packet_view_encode(&an_packet);
+	return AN_PACKET_HEADER_SIZE + an_packet.length;
+}
+
 an_packet_t* encode_raw_gnss_packet(raw_gnss_packet_t* raw_gnss_packet)
 {
 	an_packet_t* an_packet = an_packet_allocate(74, packet_id_raw_gnss);
-	if(an_packet != NULL)
-	 {
-		memcpy(&an_packet->data[0], &raw_gnss_packet->unix_time_seconds, sizeof(uint32_t));
-		memcpy(&an_packet->data[4], &raw_gnss_packet->microseconds, sizeof(uint32_t));
-		memcpy(&an_packet->data[8], &raw_gnss_packet->position[0], 3 * sizeof(double));
-		memcpy(&an_packet->data[32], &raw_gnss_packet->velocity[0], 3 * sizeof(float));
-		memcpy(&an_packet->data[44], &raw_gnss_packet->position_standard_deviation[0], 3 * sizeof(float));
-		memcpy(&an_packet->data[56], &raw_gnss_packet->tilt, sizeof(float));
-		memcpy(&an_packet->data[60], &raw_gnss_packet->heading, sizeof(float));
-		memcpy(&an_packet->data[64], &raw_gnss_packet->tilt_standard_deviation, sizeof(float));
-		memcpy(&an_packet->data[68], &raw_gnss_packet->heading_standard_deviation, sizeof(float));
-		memcpy(&an_packet->data[72], &raw_gnss_packet->flags.r, sizeof(uint16_t));
-	}
+	if(an_packet != NULL) encode_raw_gnss_packet_into(an_packet->header, AN_PACKET_HEADER_SIZE + an_packet->length, raw_gnss_packet);
 	return an_packet;
 }
 
-int decode_satellites_packet(satellites_packet_t* satellites_packet, an_packet_t* an_packet)
+int decode_satellites_packet_view(satellites_packet_t* satellites_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_satellites && an_packet->length == 13)
 	 {
@@ -411,7 +504,7 @@ int decode_satellites_packet(satellites_packet_t* satellites_packet, an_packet_t
 	else return 1;
 }
 
-int decode_geodetic_position_packet(geodetic_position_packet_t* geodetic_position_packet, an_packet_t* an_packet)
+int decode_geodetic_position_packet_view(geodetic_position_packet_t* geodetic_position_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_geodetic_position && an_packet->length == 24)
 	 {
@@ -421,7 +514,7 @@ int decode_geodetic_position_packet(geodetic_position_packet_t* geodetic_positio
 	else return 1;
 }
 
-int decode_ecef_position_packet(ecef_position_packet_t* ecef_position_packet, an_packet_t* an_packet)
+int decode_ecef_position_packet_view(ecef_position_packet_t* ecef_position_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_ecef_position && an_packet->length == 24)
 	 {
@@ -431,7 +524,7 @@ int decode_ecef_position_packet(ecef_position_packet_t* ecef_position_packet, an
 	else return 1;
 }
 
-int decode_utm_position_packet(utm_position_packet_t* utm_position_packet, an_packet_t* an_packet)
+int decode_utm_position_packet_view(utm_position_packet_t* utm_position_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_utm_position && an_packet->length == 26)
 	 {
@@ -443,7 +536,7 @@ int decode_utm_position_packet(utm_position_packet_t* utm_position_packet, an_pa
 	else return 1;
 }
 
-int decode_ned_velocity_packet(ned_velocity_packet_t* ned_velocity_packet, an_packet_t* an_packet)
+int decode_ned_velocity_packet_view(ned_velocity_packet_t* ned_velocity_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_ned_velocity && an_packet->length == 12)
 	 {
@@ -453,7 +546,7 @@ int decode_ned_velocity_packet(ned_velocity_packet_t* ned_velocity_packet, an_pa
 	else return 1;
 }
 
-int decode_body_velocity_packet(body_velocity_packet_t* body_velocity_packet, an_packet_t* an_packet)
+int decode_body_velocity_packet_view(body_velocity_packet_t* body_velocity_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_body_velocity && an_packet->length == 12)
 	 {
@@ -463,7 +556,7 @@ int decode_body_velocity_packet(body_velocity_packet_t* body_velocity_packet, an
 	else return 1;
 }
 
-int decode_acceleration_packet(acceleration_packet_t* acceleration, an_packet_t* an_packet)
+int decode_acceleration_packet_view(acceleration_packet_t* acceleration, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_acceleration && an_packet->length == 12)
 	 {
@@ -473,7 +566,7 @@ int decode_acceleration_packet(acceleration_packet_t* acceleration, an_packet_t*
 	else return 1;
 }
 
-int decode_body_acceleration_packet(body_acceleration_packet_t* body_acceleration, an_packet_t* an_packet)
+int decode_body_acceleration_packet_view(body_acceleration_packet_t* body_acceleration, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_body_acceleration && an_packet->length == 16)
 	 {
@@ -484,7 +577,7 @@ int decode_body_acceleration_packet(body_acceleration_packet_t* body_acceleratio
 	else return 1;
 }
 
-int decode_euler_orientation_packet(euler_orientation_packet_t* euler_orientation_packet, an_packet_t* an_packet)
+int decode_euler_orientation_packet_view(euler_orientation_packet_t* euler_orientation_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_euler_orientation && an_packet->length == 12)
 	 {
@@ -494,7 +587,7 @@ int decode_euler_orientation_packet(euler_orientation_packet_t* euler_orientatio
 	else return 1;
 }
 
-int decode_quaternion_orientation_packet(quaternion_orientation_packet_t* quaternion_orientation_packet, an_packet_t* an_packet)
+int decode_quaternion_orientation_packet_view(quaternion_orientation_packet_t* quaternion_orientation_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_quaternion_orientation && an_packet->length == 16)
 	 {
@@ -504,7 +597,7 @@ int decode_quaternion_orientation_packet(quaternion_orientation_packet_t* quater
 	else return 1;
 }
 
-int decode_dcm_orientation_packet(dcm_orientation_packet_t* dcm_orientation_packet, an_packet_t* an_packet)
+int decode_dcm_orientation_packet_view(dcm_orientation_packet_t* dcm_orientation_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_dcm_orientation && an_packet->length == 36)
 	 {
@@ -514,7 +607,7 @@ int decode_dcm_orientation_packet(dcm_orientation_packet_t* dcm_orientation_pack
 	else return 1;
 }
 
-int decode_angular_velocity_packet(angular_velocity_packet_t* angular_velocity_packet, an_packet_t* an_packet)
+int decode_angular_velocity_packet_view(angular_velocity_packet_t* angular_velocity_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_angular_velocity && an_packet->length == 12)
 	 {
@@ -524,7 +617,7 @@ int decode_angular_velocity_packet(angular_velocity_packet_t* angular_velocity_p
 	else return 1;
 }
 
-int decode_angular_acceleration_packet(angular_acceleration_packet_t* angular_acceleration_packet, an_packet_t* an_packet)
+int decode_angular_acceleration_packet_view(angular_acceleration_packet_t* angular_acceleration_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_angular_acceleration && an_packet->length == 12)
 	 {
@@ -534,7 +627,7 @@ int decode_angular_acceleration_packet(angular_acceleration_packet_t* angular_ac
 	else return 1;
 }
 
-int decode_external_position_velocity_packet(external_position_velocity_packet_t* external_position_velocity_packet, an_packet_t* an_packet)
+int decode_external_position_velocity_packet_view(external_position_velocity_packet_t* external_position_velocity_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_external_position_velocity && an_packet->length == 60)
 	 {
@@ -547,20 +640,26 @@ int decode_external_position_velocity_packet(external_position_velocity_packet_t
 	else return 1;
 }
 
+int encode_external_position_velocity_packet_into(uint8_t* buffer, size_t capacity, external_position_velocity_packet_t* external_position_velocity_packet)
+{
+	an_packet_view_t an_packet;
+	if(!an_packet_view_initialise(&an_packet, buffer, capacity, 60, packet_id_external_position_velocity)) return 0;
+	memcpy(&an_packet.data[0], &external_position_velocity_packet->position[0], 3 * sizeof(double));
+	memcpy(&an_packet.data[24], &external_position_velocity_packet->velocity[0], 3 * sizeof(float));
+	memcpy(&an_packet.data[36], &external_position_velocity_packet->position_standard_deviation[0], 3 * sizeof(float));
+	memcpy(&an_packet.data[48], &external_position_velocity_packet->velocity_standard_deviation[0], 3 * sizeof(float));
+	an_packet_view_encode(&an_packet);
+	return AN_PACKET_HEADER_SIZE + an_packet.length;
+}
+
 an_packet_t* encode_external_position_velocity_packet(external_position_velocity_packet_t* external_position_velocity_packet)
 {
 	an_packet_t* an_packet = an_packet_allocate(60, packet_id_external_position_velocity);
-	if(an_packet != NULL)
-	 {
-		memcpy(&an_packet->data[0], &external_position_velocity_packet->position[0], 3 * sizeof(double));
-		memcpy(&an_packet->data[24], &external_position_velocity_packet->velocity[0], 3 * sizeof(float));
-		memcpy(&an_packet->data[36], &external_position_velocity_packet->position_standard_deviation[0], 3 * sizeof(float));
-		memcpy(&an_packet->data[48], &external_position_velocity_packet->velocity_standard_deviation[0], 3 * sizeof(float));
-	}
+	if(an_packet != NULL) encode_external_position_velocity_packet_into(an_packet->header, AN_PACKET_HEADER_SIZE + an_packet->length, external_position_velocity_packet);
 	return an_packet;
 }
 
-int decode_external_position_packet(external_position_packet_t* external_position_packet, an_packet_t* an_packet)
+int decode_external_position_packet_view(external_position_packet_t* external_position_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_external_position && an_packet->length == 36)
 	 {
@@ -571,18 +670,24 @@ int decode_external_position_packet(external_position_packet_t* external_positio
 	else return 1;
 }
 
+int encode_external_position_packet_into(uint8_t* buffer, size_t capacity, external_position_packet_t* external_position_packet)
+{
+	an_packet_view_t an_packet;
+	if(!an_packet_view_initialise(&an_packet, buffer, capacity, 36, packet_id_external_position)) return 0;
+	memcpy(&an_packet.data[0], &external_position_packet->position[0], 3 * sizeof(double));
+	memcpy(&an_packet.data[24], &external_position_packet->standard_deviation[0], 3 * sizeof(float));
+	an_packet_view_encode(&an_packet);
+	return AN_PACKET_HEADER_SIZE + an_packet.length;
+}
+
 an_packet_t* encode_external_position_packet(external_position_packet_t* external_position_packet)
 {
 	an_packet_t* an_packet = an_packet_allocate(36, packet_id_external_position);
-	if(an_packet != NULL)
-	 {
-		memcpy(&an_packet->data[0], &external_position_packet->position[0], 3 * sizeof(double));
-		memcpy(&an_packet->data[24], &external_position_packet->standard_deviation[0], 3 * sizeof(float));
-	}
+	if(an_packet != NULL) encode_external_position_packet_into(an_packet->header, AN_PACKET_HEADER_SIZE + an_packet->length, external_position_packet);
 	return an_packet;
 }
 
-int decode_external_velocity_packet(external_velocity_packet_t* external_velocity_packet, an_packet_t* an_packet)
+int decode_external_velocity_packet_view(external_velocity_packet_t* external_velocity_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_external_velocity && an_packet->length == 24)
 	 {
@@ -593,18 +698,24 @@ int decode_external_velocity_packet(external_velocity_packet_t* external_velocit
 	else return 1;
 }
 
+int encode_external_velocity_packet_into(uint8_t* buffer, size_t capacity, external_velocity_packet_t* external_velocity_packet)
+{
+	an_packet_view_t an_packet;
+	if(!an_packet_view_initialise(&an_packet, buffer, capacity, 24, packet_id_external_velocity)) return 0;
+	memcpy(&an_packet.data[0], &external_velocity_packet->velocity[0], 3 * sizeof(float));
+	memcpy(&an_packet.data[12], &external_velocity_packet->standard_deviation[0], 3 * sizeof(float));
+	an_packet_view_encode(&an_packet);
+	return AN_PACKET_HEADER_SIZE + an_packet.length;
+}
+
 an_packet_t* encode_external_velocity_packet(external_velocity_packet_t* external_velocity_packet)
 {
 	an_packet_t* an_packet = an_packet_allocate(24, packet_id_external_velocity);
-	if(an_packet != NULL)
-	 {
-		memcpy(&an_packet->data[0], &external_velocity_packet->velocity[0], 3 * sizeof(float));
-		memcpy(&an_packet->data[12], &external_velocity_packet->standard_deviation[0], 3 * sizeof(float));
-	}
+	if(an_packet != NULL) encode_external_velocity_packet_into(an_packet->header, AN_PACKET_HEADER_SIZE + an_packet->length, external_velocity_packet);
 	return an_packet;
 }
 
-int decode_external_body_velocity_packet(external_body_velocity_packet_t* external_body_velocity_packet, an_packet_t* an_packet)
+int decode_external_body_velocity_packet_view(external_body_velocity_packet_t* external_body_velocity_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_external_body_velocity && an_packet->length == 16)
 	 {
@@ -615,18 +726,24 @@ int decode_external_body_velocity_packet(external_body_velocity_packet_t* extern
 	else return 1;
 }
 
+int encode_external_body_velocity_packet_into(uint8_t* buffer, size_t capacity, external_body_velocity_packet_t* external_body_velocity_packet)
+{
+	an_packet_view_t an_packet;
+	if(!an_packet_view_initialise(&an_packet, buffer, capacity, 16, packet_id_external_body_velocity)) return 0;
+	memcpy(&an_packet.data[0], &external_body_velocity_packet->velocity[0], 3 * sizeof(float));
+	memcpy(&an_packet.data[12], &external_body_velocity_packet->standard_deviation, sizeof(float));
+	an_packet_view_encode(&an_packet);
+	return AN_PACKET_HEADER_SIZE + an_packet.length;
+}
+
 an_packet_t* encode_external_body_velocity_packet(external_body_velocity_packet_t* external_body_velocity_packet)
 {
 	an_packet_t* an_packet = an_packet_allocate(16, packet_id_external_body_velocity);
-	if(an_packet != NULL)
-	 {
-		memcpy(&an_packet->data[0], &external_body_velocity_packet->velocity[0], 3 * sizeof(float));
-		memcpy(&an_packet->data[12], &external_body_velocity_packet->standard_deviation, sizeof(float));
-	}
+	if(an_packet != NULL) encode_external_body_velocity_packet_into(an_packet->header, AN_PACKET_HEADER_SIZE + an_packet->length, external_body_velocity_packet);
 	return an_packet;
 }
 
-int decode_external_heading_packet(external_heading_packet_t* external_heading_packet, an_packet_t* an_packet)
+int decode_external_heading_packet_view(external_heading_packet_t* external_heading_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_external_heading && an_packet->length == 8)
 	 {
@@ -637,18 +754,24 @@ int decode_external_heading_packet(external_heading_packet_t* external_heading_p
 	else return 1;
 }
 
+int encode_external_heading_packet_into(uint8_t* buffer, size_t capacity, external_heading_packet_t* external_heading_packet)
+{
+	an_packet_view_t an_packet;
+	if(!an_packet_view_initialise(&an_packet, buffer, capacity, 8, packet_id_external_heading)) return 0;
+	memcpy(&an_packet.data[0], &external_heading_packet->heading, sizeof(float));
+	memcpy(&an_packet.data[4], &external_heading_packet->standard_deviation, sizeof(float));
+	an_packet_view_encode(&an_packet);
+	return AN_PACKET_HEADER_SIZE + an_packet.length;
+}
+
 an_packet_t* encode_external_heading_packet(external_heading_packet_t* external_heading_packet)
 {
 	an_packet_t* an_packet = an_packet_allocate(8, packet_id_external_heading);
-	if(an_packet != NULL)
-	 {
-		memcpy(&an_packet->data[0], &external_heading_packet->heading, sizeof(float));
-		memcpy(&an_packet->data[4], &external_heading_packet->standard_deviation, sizeof(float));
-	}
+	if(an_packet != NULL) encode_external_heading_packet_into(an_packet->header, AN_PACKET_HEADER_SIZE + an_packet->length, external_heading_packet);
 	return an_packet;
 }
 
-int decode_running_time_packet(running_time_packet_t* running_time_packet, an_packet_t* an_packet)
+int decode_running_time_packet_view(running_time_packet_t* running_time_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_running_time && an_packet->length == 8)
 	 {
@@ -659,7 +782,7 @@ int decode_running_time_packet(running_time_packet_t* running_time_packet, an_pa
 	else return 1;
 }
 
-int decode_local_magnetics_packet(local_magnetics_packet_t* local_magnetics_packet, an_packet_t* an_packet)
+int decode_local_magnetics_packet_view(local_magnetics_packet_t* local_magnetics_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_local_magnetics && an_packet->length == 12)
 	 {
@@ -669,7 +792,7 @@ int decode_local_magnetics_packet(local_magnetics_packet_t* local_magnetics_pack
 	else return 1;
 }
 
-int decode_odometer_state_packet(odometer_state_packet_t* odometer_state_packet, an_packet_t* an_packet)
+int decode_odometer_state_packet_view(odometer_state_packet_t* odometer_state_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_odometer_state && an_packet->length == 20)
 	 {
@@ -683,7 +806,7 @@ int decode_odometer_state_packet(odometer_state_packet_t* odometer_state_packet,
 	else return 1;
 }
 
-int decode_external_time_packet(external_time_packet_t* external_time_packet, an_packet_t* an_packet)
+int decode_external_time_packet_view(external_time_packet_t* external_time_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_external_time && an_packet->length == 8)
 	 {
@@ -694,18 +817,24 @@ int decode_external_time_packet(external_time_packet_t* external_time_packet, an
 	else return 1;
 }
 
+int encode_external_time_packet_into(uint8_t* buffer, size_t capacity, external_time_packet_t* external_time_packet)
+{
+	an_packet_view_t an_packet;
+	if(!an_packet_view_initialise(&an_packet, buffer, capacity, 8, packet_id_external_time)) return 0;
+	memcpy(&an_packet.data[0], &external_time_packet->unix_time_seconds, sizeof(float));
+	memcpy(&an_packet.data[4], &external_time_packet->microseconds, sizeof(float));
+	an_packet_view_encode(&an_packet);
+	return AN_PACKET_HEADER_SIZE + an_packet.length;
+}
+
 an_packet_t* encode_external_time_packet(external_time_packet_t* external_time_packet)
 {
 	an_packet_t* an_packet = an_packet_allocate(8, packet_id_external_time);
-	if(an_packet != NULL)
-	 {
-		memcpy(&an_packet->data[0], &external_time_packet->unix_time_seconds, sizeof(float));
-		memcpy(&an_packet->data[4], &external_time_packet->microseconds, sizeof(float));
-	}
+	if(an_packet != NULL) encode_external_time_packet_into(an_packet->header, AN_PACKET_HEADER_SIZE + an_packet->length, external_time_packet);
 	return an_packet;
 }
 
-int decode_external_depth_packet(external_depth_packet_t* external_depth_packet, an_packet_t* an_packet)
+int decode_external_depth_packet_view(external_depth_packet_t* external_depth_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_external_depth && an_packet->length == 8)
 	 {
@@ -716,18 +845,24 @@ int decode_external_depth_packet(external_depth_packet_t* external_depth_packet,
 	else return 1;
 }
 
+int encode_external_depth_packet_into(uint8_t* buffer, size_t capacity, external_depth_packet_t* external_depth_packet)
+{
+	an_packet_view_t an_packet;
+	if(!an_packet_view_initialise(&an_packet, buffer, capacity, 8, packet_id_external_depth)) return 0;
+	memcpy(&an_packet.data[0], &external_depth_packet->depth, sizeof(float));
+	memcpy(&an_packet.data[4], &external_depth_packet->standard_deviation, sizeof(float));
+	an_packet_view_encode(&an_packet);
+	return AN_PACKET_HEADER_SIZE + an_packet.length;
+}
+
 an_packet_t* encode_external_depth_packet(external_depth_packet_t* external_depth_packet)
 {
 	an_packet_t* an_packet = an_packet_allocate(8, packet_id_external_depth);
-	if(an_packet != NULL)
-	 {
-		memcpy(&an_packet->data[0], &external_depth_packet->depth, sizeof(float));
-		memcpy(&an_packet->data[4], &external_depth_packet->standard_deviation, sizeof(float));
-	}
+	if(an_packet != NULL) encode_external_depth_packet_into(an_packet->header, AN_PACKET_HEADER_SIZE + an_packet->length, external_depth_packet);
 	return an_packet;
 }
 
-int decode_geoid_height_packet(geoid_height_packet_t* geoid_height_packet, an_packet_t* an_packet)
+int decode_geoid_height_packet_view(geoid_height_packet_t* geoid_height_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_geoid_height && an_packet->length == 4)
 	 {
@@ -737,17 +872,23 @@ int decode_geoid_height_packet(geoid_height_packet_t* geoid_height_packet, an_pa
 	else return 1;
 }
 
+int encode_rtcm_corrections_packet_into(uint8_t* buffer, size_t capacity, rtcm_corrections_packet_t* rtcm_corrections_packet, int data_size)
+{
+	an_packet_view_t an_packet;
+	if(!an_packet_view_initialise(&an_packet, buffer, capacity, data_size, packet_id_rtcm_corrections)) return 0;
+	memcpy(&an_packet.data[0], rtcm_corrections_packet->packet_data, data_size);
+	an_packet_view_encode(&an_packet);
+	return AN_PACKET_HEADER_SIZE + an_packet.length;
+}
+
 an_packet_t* encode_rtcm_corrections_packet(rtcm_corrections_packet_t* rtcm_corrections_packet, int data_size)
 {
 	an_packet_t* an_packet = an_packet_allocate(data_size, packet_id_rtcm_corrections);
-	if(an_packet != NULL)
-	 {
-		memcpy(&an_packet->data[0], rtcm_corrections_packet->packet_data, data_size);
-	}
+	if(an_packet != NULL) encode_rtcm_corrections_packet_into(an_packet->header, AN_PACKET_HEADER_SIZE + an_packet->length, rtcm_corrections_packet, data_size);
 	return an_packet;
 }
 
-int decode_wind_packet(wind_packet_t* wind_packet, an_packet_t* an_packet)
+int decode_wind_packet_view(wind_packet_t* wind_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_wind && an_packet->length == 12)
 	 {
@@ -758,18 +899,24 @@ int decode_wind_packet(wind_packet_t* wind_packet, an_packet_t* an_packet)
 	else return 1;
 }
 
+int encode_wind_packet_into(uint8_t* buffer, size_t capacity, wind_packet_t* wind_packet)
+{
+	an_packet_view_t an_packet;
+	if(!an_packet_view_initialise(&an_packet, buffer, capacity, 12, packet_id_wind)) return 0;
+	memcpy(&an_packet.data[0], &wind_packet->wind_velocity[0], 2 * sizeof(float));
+	memcpy(&an_packet.data[8], &wind_packet->wind_standard_deviation, sizeof(float));
+	an_packet_view_encode(&an_packet);
+	return AN_PACKET_HEADER_SIZE + an_packet.length;
+}
+
 an_packet_t* encode_wind_packet(wind_packet_t* wind_packet)
 {
 	an_packet_t* an_packet = an_packet_allocate(12, packet_id_wind);
-	if(an_packet != NULL)
-	 {
-		memcpy(&an_packet->data[0], &wind_packet->wind_velocity[0], 2 * sizeof(float));
-		memcpy(&an_packet->data[8], &wind_packet->wind_standard_deviation, sizeof(float));
-	}
+	if(an_packet != NULL) encode_wind_packet_into(an_packet->header, AN_PACKET_HEADER_SIZE + an_packet->length, wind_packet);
 	return an_packet;
 }
 
-int decode_heave_packet(heave_packet_t* heave_packet, an_packet_t* an_packet)
+int decode_heave_packet_view(heave_packet_t* heave_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_heave && an_packet->length == 16)
 	 {
@@ -782,7 +929,7 @@ int decode_heave_packet(heave_packet_t* heave_packet, an_packet_t* an_packet)
 	else return 1;
 }
 
-int decode_raw_satellite_ephemeris_packet(raw_satellite_ephemeris_packet_t* raw_satellite_ephemeris_packet, an_packet_t* an_packet)
+int decode_raw_satellite_ephemeris_packet_view(raw_satellite_ephemeris_packet_t* raw_satellite_ephemeris_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_raw_satellite_ephemeris)
 	 {
@@ -855,7 +1002,7 @@ int decode_raw_satellite_ephemeris_packet(raw_satellite_ephemeris_packet_t* raw_
 	else return 1;
 }
 
-int decode_external_odometer_packet(odometer_packet_t* external_odometer_packet, an_packet_t* an_packet)
+int decode_external_odometer_packet_view(odometer_packet_t* external_odometer_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_external_odometer && an_packet->length == 13)
 	 {
@@ -868,20 +1015,26 @@ int decode_external_odometer_packet(odometer_packet_t* external_odometer_packet,
 	else return 1;
 }
 
+int encode_external_odometer_packet_into(uint8_t* buffer, size_t capacity, odometer_packet_t* external_odometer_packet)
+{
+	an_packet_view_t an_packet;
+	if(!an_packet_view_initialise(&an_packet, buffer, capacity, 13, packet_id_external_odometer)) return 0;
+	memcpy(&an_packet.data[0], &external_odometer_packet->delay, sizeof(float));
+	memcpy(&an_packet.data[4], &external_odometer_packet->speed, sizeof(float));
+	memcpy(&an_packet.data[8], &external_odometer_packet->distance_travelled, sizeof(float));
+	an_packet.data[12] = external_odometer_packet->flags.r;
+	an_packet_view_encode(&an_packet);
+	return AN_PACKET_HEADER_SIZE + an_packet.length;
+}
+
 an_packet_t* encode_external_odometer_packet(odometer_packet_t* external_odometer_packet)
 {
 	an_packet_t* an_packet = an_packet_allocate(13, packet_id_external_odometer);
-	if(an_packet != NULL)
-	 {
-		memcpy(&an_packet->data[0], &external_odometer_packet->delay, sizeof(float));
-		memcpy(&an_packet->data[4], &external_odometer_packet->speed, sizeof(float));
-		memcpy(&an_packet->data[8], &external_odometer_packet->distance_travelled, sizeof(float));
-		an_packet->data[12] = external_odometer_packet->flags.r;
-	}
+	if(an_packet != NULL) encode_external_odometer_packet_into(an_packet->header, AN_PACKET_HEADER_SIZE + an_packet->length, external_odometer_packet);
 	return an_packet;
 }
 
-int decode_external_air_data_packet(external_air_data_packet_t* external_air_data_packet, an_packet_t* an_packet)
+int decode_external_air_data_packet_view(external_air_data_packet_t* external_air_data_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_external_air_data && an_packet->length == 25)
 	 {
@@ -897,23 +1050,29 @@ int decode_external_air_data_packet(external_air_data_packet_t* external_air_dat
 	else return 1;
 }
 
+int encode_external_air_data_packet_into(uint8_t* buffer, size_t capacity, external_air_data_packet_t* external_air_data_packet)
+{
+	an_packet_view_t an_packet;
+	if(!an_packet_view_initialise(&an_packet, buffer, capacity, 25, packet_id_external_air_data)) return 0;
+	memcpy(&an_packet.data[0], &external_air_data_packet->barometric_altitude_delay, sizeof(float));
+	memcpy(&an_packet.data[4], &external_air_data_packet->airspeed_delay, sizeof(float));
+	memcpy(&an_packet.data[8], &external_air_data_packet->barometric_altitude, sizeof(float));
+	memcpy(&an_packet.data[12], &external_air_data_packet->airspeed, sizeof(float));
+	memcpy(&an_packet.data[16], &external_air_data_packet->barometric_altitude_standard_deviation, sizeof(float));
+	memcpy(&an_packet.data[20], &external_air_data_packet->airspeed_standard_deviation, sizeof(float));
+	an_packet.data[24] = external_air_data_packet->flags.r;
+	an_packet_view_encode(&an_packet);
+	return AN_PACKET_HEADER_SIZE + an_packet.length;
+}
+
 an_packet_t* encode_external_air_data_packet(external_air_data_packet_t* external_air_data_packet)
 {
 	an_packet_t* an_packet = an_packet_allocate(25, packet_id_external_air_data);
-	if(an_packet != NULL)
-	 {
-		memcpy(&an_packet->data[0], &external_air_data_packet->barometric_altitude_delay, sizeof(float));
-		memcpy(&an_packet->data[4], &external_air_data_packet->airspeed_delay, sizeof(float));
-		memcpy(&an_packet->data[8], &external_air_data_packet->barometric_altitude, sizeof(float));
-		memcpy(&an_packet->data[12], &external_air_data_packet->airspeed, sizeof(float));
-		memcpy(&an_packet->data[16], &external_air_data_packet->barometric_altitude_standard_deviation, sizeof(float));
-		memcpy(&an_packet->data[20], &external_air_data_packet->airspeed_standard_deviation, sizeof(float));
-		an_packet->data[24] = external_air_data_packet->flags.r;
-	}
+	if(an_packet != NULL) encode_external_air_data_packet_into(an_packet->header, AN_PACKET_HEADER_SIZE + an_packet->length, external_air_data_packet);
 	return an_packet;
 }
 
-int decode_gnss_information_packet(gnss_receiver_information_packet_t* gnss_information_packet, an_packet_t* an_packet)
+int decode_gnss_information_packet_view(gnss_receiver_information_packet_t* gnss_information_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_gnss_receiver_information && an_packet->length == 48)
 	 {
@@ -933,7 +1092,7 @@ int decode_gnss_information_packet(gnss_receiver_information_packet_t* gnss_info
 	else return 1;
 }
 
-int decode_raw_dvl_data_packet(raw_dvl_data_packet_t* raw_dvl_data_packet, an_packet_t* an_packet)
+int decode_raw_dvl_data_packet_view(raw_dvl_data_packet_t* raw_dvl_data_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_raw_dvl_data && an_packet->length == 60)
 	 {
@@ -953,7 +1112,7 @@ int decode_raw_dvl_data_packet(raw_dvl_data_packet_t* raw_dvl_data_packet, an_pa
 	else return 1;
 }
 
-int decode_north_seeking_status_packet(north_seeking_status_packet_t* north_seeking_status_packet, an_packet_t* an_packet)
+int decode_north_seeking_status_packet_view(north_seeking_status_packet_t* north_seeking_status_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_north_seeking_status && an_packet->length == 28)
 	 {
@@ -968,7 +1127,7 @@ int decode_north_seeking_status_packet(north_seeking_status_packet_t* north_seek
 }
 
 
-int decode_gimbal_state_packet(gimbal_state_packet_t* gimbal_state_packet, an_packet_t* an_packet)
+int decode_gimbal_state_packet_view(gimbal_state_packet_t* gimbal_state_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_gimbal_state && an_packet->length == 8)
 	 {
@@ -978,18 +1137,24 @@ int decode_gimbal_state_packet(gimbal_state_packet_t* gimbal_state_packet, an_pa
 	else return 1;
 }
 
+int encode_gimbal_state_packet_into(uint8_t* buffer, size_t capacity, gimbal_state_packet_t* gimbal_state_packet)
+{
+	an_packet_view_t an_packet;
+	if(!an_packet_view_initialise(&an_packet, buffer, capacity, 8, packet_id_gimbal_state)) return 0;
+	memcpy(&an_packet.data[0], &gimbal_state_packet->current_angle, sizeof(float));
+	memset(&an_packet.data[4], 0, 4 * sizeof(uint8_t));
+	an_packet_view_encode(&an_packet);
+	return AN_PACKET_HEADER_SIZE + an_packet.length;
+}
+
 an_packet_t* encode_gimbal_state_packet(gimbal_state_packet_t* gimbal_state_packet)
 {
 	an_packet_t* an_packet = an_packet_allocate(8, packet_id_gimbal_state);
-	if(an_packet != NULL)
-	 {
-		memcpy(&an_packet->data[0], &gimbal_state_packet->current_angle, sizeof(float));
-		memset(&an_packet->data[4], 0, 4 * sizeof(uint8_t));
-	}
+	if(an_packet != NULL) encode_gimbal_state_packet_into(an_packet->header, AN_PACKET_HEADER_SIZE + an_packet->length, gimbal_state_packet);
 	return an_packet;
 }
 
-int decode_automotive_packet(automotive_packet_t* automotive_packet, an_packet_t* an_packet)
+int decode_automotive_packet_view(automotive_packet_t* automotive_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_automotive && an_packet->length == 24)
 	 {
@@ -1003,7 +1168,7 @@ int decode_automotive_packet(automotive_packet_t* automotive_packet, an_packet_t
 	else return 1;
 }
 
-int decode_external_magnetometers_packet(external_magnetometers_packet_t* external_magnetometers_packet, an_packet_t* an_packet)
+int decode_external_magnetometers_packet_view(external_magnetometers_packet_t* external_magnetometers_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_external_magnetometers && an_packet->length == 17)
 	 {
@@ -1015,29 +1180,42 @@ int decode_external_magnetometers_packet(external_magnetometers_packet_t* extern
 	else return 1;
 }
 
+int encode_external_magnetometers_packet_into(uint8_t* buffer, size_t capacity, external_magnetometers_packet_t* external_magnetometers_packet)
+{
+	an_packet_view_t an_packet;
+	if(!an_packet_view_initialise(&an_packet, buffer, capacity, 17, packet_id_external_magnetometers)) return 0;
+	memcpy(&an_packet.data[0], &external_magnetometers_packet->delay, sizeof(float));
+	memcpy(&an_packet.data[4], &external_magnetometers_packet->magnetometer[0], 3 * sizeof(float));
+	memcpy(&an_packet.data[16], &external_magnetometers_packet->flags, sizeof(uint8_t));
+	an_packet_view_encode(&an_packet);
+	return AN_PACKET_HEADER_SIZE + an_packet.length;
+}
+
 an_packet_t* encode_external_magnetometers_packet(external_magnetometers_packet_t* external_magnetometers_packet)
 {
 	an_packet_t* an_packet = an_packet_allocate(17, packet_id_external_magnetometers);
-	if(an_packet != NULL)
-	 {
-		memcpy(&an_packet->data[0], &external_magnetometers_packet->delay, sizeof(float));
-		memcpy(&an_packet->data[4], &external_magnetometers_packet->magnetometer[0], 3 * sizeof(float));
-		memcpy(&an_packet->data[16], &external_magnetometers_packet->flags, sizeof(uint8_t));
-	}
+	if(an_packet != NULL) encode_external_magnetometers_packet_into(an_packet->header, AN_PACKET_HEADER_SIZE + an_packet->length, external_magnetometers_packet);
 	return an_packet;
 }
 
+int encode_zero_angular_velocity_packet_into(uint8_t* buffer, size_t capacity, zero_angular_velocity_packet_t* zero_angular_velocity_packet)
+{
+	an_packet_view_t an_packet;
+	if(!an_packet_view_initialise(&an_packet, buffer, capacity, 8, packet_id_zero_angular_velocity)) return 0;
+	memcpy(&an_packet.data[0], &zero_angular_velocity_packet->duration, sizeof(float));
+	memset(&an_packet.data[4], 0, 4 * sizeof(uint8_t));
+	an_packet_view_encode(&an_packet);
+	return AN_PACKET_HEADER_SIZE + an_packet.length;
+}
+
 an_packet_t* encode_zero_angular_velocity_packet(zero_angular_velocity_packet_t* zero_angular_velocity_packet)
 {
 	an_packet_t* an_packet = an_packet_allocate(8, packet_id_zero_angular_velocity);
-	if(an_packet != NULL)
-	 {
-		memcpy(&an_packet->data[0], &zero_angular_velocity_packet->duration, sizeof(float));
-	}
+	if(an_packet != NULL) encode_zero_angular_velocity_packet_into(an_packet->header, AN_PACKET_HEADER_SIZE + an_packet->length, zero_angular_velocity_packet);
 	return an_packet;
 }
 
-int decode_extended_satellites_packet(extended_satellites_packet_t* extended_satellites_packet, an_packet_t* an_packet)
+int decode_extended_satellites_packet_view(extended_satellites_packet_t* extended_satellites_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_extended_satellites && (an_packet->length - 2) % 9 == 0)
 	 {
@@ -1065,7 +1243,7 @@ int decode_extended_satellites_packet(extended_satellites_packet_t* extended_sat
 	else return 1;
 }
 
-int decode_packet_timer_period_packet(packet_timer_period_packet_t* packet_timer_period_packet, an_packet_t* an_packet)
+int decode_packet_timer_period_packet_view(packet_timer_period_packet_t* packet_timer_period_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_packet_timer_period && an_packet->length == 4)
 	 {
@@ -1077,19 +1255,25 @@ int decode_packet_timer_period_packet(packet_timer_period_packet_t* packet_timer
 	else return 1;
 }
 
+int encode_packet_timer_period_packet_into(uint8_t* buffer, size_t capacity, packet_timer_period_packet_t* packet_timer_period_packet)
+{
+	an_packet_view_t an_packet;
+	if(!an_packet_view_initialise(&an_packet, buffer, capacity, 4, packet_id_packet_timer_period)) return 0;
+	an_packet.data[0] = packet_timer_period_packet->permanent > 0;
+	an_packet.data[1] = packet_timer_period_packet->utc_synchronisation > 0;
+	memcpy(&an_packet.data[2], &packet_timer_period_packet->packet_timer_period, sizeof(uint16_t));
+	an_packet_view_encode(&an_packet);
+	return AN_PACKET_HEADER_SIZE + an_packet.length;
+}
+
 an_packet_t* encode_packet_timer_period_packet(packet_timer_period_packet_t* packet_timer_period_packet)
 {
 	an_packet_t* an_packet = an_packet_allocate(4, packet_id_packet_timer_period);
-	if(an_packet != NULL)
-	 {
-		an_packet->data[0] = packet_timer_period_packet->permanent > 0;
-		an_packet->data[1] = packet_timer_period_packet->utc_synchronisation > 0;
-		memcpy(&an_packet->data[2], &packet_timer_period_packet->packet_timer_period, sizeof(uint16_t));
-	}
+	if(an_packet != NULL) encode_packet_timer_period_packet_into(an_packet->header, AN_PACKET_HEADER_SIZE + an_packet->length, packet_timer_period_packet);
 	return an_packet;
 }
 
-int decode_packet_periods_packet(packet_periods_packet_t* packet_periods_packet, an_packet_t* an_packet)
+int decode_packet_periods_packet_view(packet_periods_packet_t* packet_periods_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_packet_periods && (an_packet->length - 2) % 5 == 0)
 	 {
@@ -1111,29 +1295,41 @@ int decode_packet_periods_packet(packet_periods_packet_t* packet_periods_packet,
 	else return 1;
 }
 
-an_packet_t* encode_packet_periods_packet(packet_periods_packet_t* packet_periods_packet)
+/*
+ * Function to count the periods that are sent, which end at the first empty packet id
+ */
+static int count_packet_periods(packet_periods_packet_t* packet_periods_packet)
+{
+	int i;
+	for(i = 0; i < MAXIMUM_PACKET_PERIODS && packet_periods_packet->packet_periods[i].packet_id; i++);
+	return i;
+}
+
+int encode_packet_periods_packet_into(uint8_t* buffer, size_t capacity, packet_periods_packet_t* packet_periods_packet)
 {
 	int i;
-	an_packet_t* an_packet = an_packet_allocate(252, packet_id_packet_periods);
-	if(an_packet != NULL)
+	int packet_periods_count = count_packet_periods(packet_periods_packet);
+	an_packet_view_t an_packet;
+	if(!an_packet_view_initialise(&an_packet, buffer, capacity, 2 + 5 * packet_periods_count, packet_id_packet_periods)) return 0;
+	an_packet.data[0] = packet_periods_packet->permanent > 0;
+	an_packet.data[1] = packet_periods_packet->clear_existing_packets;
+	for(i = 0; i < packet_periods_count; i++)
 	 {
-		an_packet->data[0] = packet_periods_packet->permanent > 0;
-		an_packet->data[1] = packet_periods_packet->clear_existing_packets;
-		for(i = 0; i < MAXIMUM_PACKET_PERIODS; i++)
-		 {
-			if(packet_periods_packet->packet_periods[i].packet_id)
-			 {
-				an_packet->data[2 + 5 * i] = packet_periods_packet->packet_periods[i].packet_id;
-				memcpy(&an_packet->data[2 + 5 * i + 1], &packet_periods_packet->packet_periods[i].period, sizeof(uint32_t));
-			}
-			else break;
-		}
-		an_packet->length = 2 + 5 * i;
+		an_packet.data[2 + 5 * i] = packet_periods_packet->packet_periods[i].packet_id;
+		memcpy(&an_packet.data[2 + 5 * i + 1], &packet_periods_packet->packet_periods[i].period, sizeof(uint32_t));
 	}
+	an_packet_view_encode(&an_packet);
+	return AN_PACKET_HEADER_SIZE + an_packet.length;
+}
+
+an_packet_t* encode_packet_periods_packet(packet_periods_packet_t* packet_periods_packet)
+{
+	an_packet_t* an_packet = an_packet_allocate(2 + 5 * count_packet_periods(packet_periods_packet), packet_id_packet_periods);
+	if(an_packet != NULL) encode_packet_periods_packet_into(an_packet->header, AN_PACKET_HEADER_SIZE + an_packet->length, packet_periods_packet);
 	return an_packet;
 }
 
-int decode_baud_rates_packet(baud_rates_packet_t* baud_rates_packet, an_packet_t* an_packet)
+int decode_baud_rates_packet_view(baud_rates_packet_t* baud_rates_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_baud_rates && an_packet->length == 17)
 	 {
@@ -1147,21 +1343,27 @@ int decode_baud_rates_packet(baud_rates_packet_t* baud_rates_packet, an_packet_t
 	else return 1;
 }
 
+int encode_baud_rates_packet_into(uint8_t* buffer, size_t capacity, baud_rates_packet_t* baud_rates_packet)
+{
+	an_packet_view_t an_packet;
+	if(!an_packet_view_initialise(&an_packet, buffer, capacity, 17, packet_id_baud_rates)) return 0;
+	an_packet.data[0] = baud_rates_packet->permanent;
+	memcpy(&an_packet.data[1], &baud_rates_packet->primary_baud_rate, sizeof(uint32_t));
+	memcpy(&an_packet.data[5], &baud_rates_packet->gpio_1_2_baud_rate, sizeof(uint32_t));
+	memcpy(&an_packet.data[9], &baud_rates_packet->auxiliary_baud_rate, sizeof(uint32_t));
+	memcpy(&an_packet.data[13], &baud_rates_packet->reserved, sizeof(uint32_t));
+	an_packet_view_encode(&an_packet);
+	return AN_PACKET_HEADER_SIZE + an_packet.length;
+}
+
 an_packet_t* encode_baud_rates_packet(baud_rates_packet_t* baud_rates_packet)
 {
 	an_packet_t* an_packet = an_packet_allocate(17, packet_id_baud_rates);
-	if(an_packet != NULL)
-	 {
-		an_packet->data[0] = baud_rates_packet->permanent;
-		memcpy(&an_packet->data[1], &baud_rates_packet->primary_baud_rate, sizeof(uint32_t));
-		memcpy(&an_packet->data[5], &baud_rates_packet->gpio_1_2_baud_rate, sizeof(uint32_t));
-		memcpy(&an_packet->data[9], &baud_rates_packet->auxiliary_baud_rate, sizeof(uint32_t));
-		memcpy(&an_packet->data[13], &baud_rates_packet->reserved, sizeof(uint32_t));
-	}
+	if(an_packet != NULL) encode_baud_rates_packet_into(an_packet->header, AN_PACKET_HEADER_SIZE + an_packet->length, baud_rates_packet);
 	return an_packet;
 }
 
-int decode_installation_alignment_packet(installation_alignment_packet_t* installation_alignment_packet, an_packet_t* an_packet)
+int decode_installation_alignment_packet_view(installation_alignment_packet_t* installation_alignment_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_installation_alignment && an_packet->length == 73)
 	 {
@@ -1175,21 +1377,27 @@ int decode_installation_alignment_packet(installation_alignment_packet_t* instal
 	else return 1;
 }
 
+int encode_installation_alignment_packet_into(uint8_t* buffer, size_t capacity, installation_alignment_packet_t* installation_alignment_packet)
+{
+	an_packet_view_t an_packet;
+	if(!an_packet_view_initialise(&an_packet, buffer, capacity, 73, packet_id_installation_alignment)) return 0;
+	an_packet.data[0] = installation_alignment_packet->permanent;
+	memcpy(&an_packet.data[1], &installation_alignment_packet->alignment_dcm[0][0], 9 * sizeof(float));
+	memcpy(&an_packet.data[37], &installation_alignment_packet->gnss_antenna_offset[0], 3 * sizeof(float));
+	memcpy(&an_packet.data[49], &installation_alignment_packet->odometer_offset[0], 3 * sizeof(float));
+	memcpy(&an_packet.data[61], &installation_alignment_packet->external_data_offset[0], 3 * sizeof(float));
+	an_packet_view_encode(&an_packet);
+	return AN_PACKET_HEADER_SIZE + an_packet.length;
+}
+
 an_packet_t* encode_installation_alignment_packet(installation_alignment_packet_t* installation_alignment_packet)
 {
 	an_packet_t* an_packet = an_packet_allocate(73, packet_id_installation_alignment);
-	if(an_packet != NULL)
-	 {
-		an_packet->data[0] = installation_alignment_packet->permanent;
-		memcpy(&an_packet->data[1], &installation_alignment_packet->alignment_dcm[0][0], 9 * sizeof(float));
-		memcpy(&an_packet->data[37], &installation_alignment_packet->gnss_antenna_offset[0], 3 * sizeof(float));
-		memcpy(&an_packet->data[49], &installation_alignment_packet->odometer_offset[0], 3 * sizeof(float));
-		memcpy(&an_packet->data[61], &installation_alignment_packet->external_data_offset[0], 3 * sizeof(float));
-	}
+	if(an_packet != NULL) encode_installation_alignment_packet_into(an_packet->header, AN_PACKET_HEADER_SIZE + an_packet->length, installation_alignment_packet);
 	return an_packet;
 }
 
-int decode_filter_options_packet(filter_options_packet_t* filter_options_packet, an_packet_t* an_packet)
+int decode_filter_options_packet_view(filter_options_packet_t* filter_options_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_filter_options && an_packet->length == 17)
 	 {
@@ -1199,43 +1407,55 @@ int decode_filter_options_packet(filter_options_packet_t* filter_options_packet,
 	else return 1;
 }
 
+int encode_filter_options_packet_into(uint8_t* buffer, size_t capacity, filter_options_packet_t* filter_options_packet)
+{
+	an_packet_view_t an_packet;
+	if(!an_packet_view_initialise(&an_packet, buffer, capacity, 17, packet_id_filter_options)) return 0;
+	memcpy(&an_packet.data[0], filter_options_packet, 9 * sizeof(uint8_t));
+	memset(&an_packet.data[9], 0, 8 * sizeof(uint8_t));
+	an_packet_view_encode(&an_packet);
+	return AN_PACKET_HEADER_SIZE + an_packet.length;
+}
+
 an_packet_t* encode_filter_options_packet(filter_options_packet_t* filter_options_packet)
 {
 	an_packet_t* an_packet = an_packet_allocate(17, packet_id_filter_options);
-	if(an_packet != NULL)
-	 {
-		memcpy(&an_packet->data[0], filter_options_packet, 9 * sizeof(uint8_t));
-		memset(&an_packet->data[9], 0, 8 * sizeof(uint8_t));
-	}
+	if(an_packet != NULL) encode_filter_options_packet_into(an_packet->header, AN_PACKET_HEADER_SIZE + an_packet->length, filter_options_packet);
 	return an_packet;
 }
 
-int decode_gpio_configuration_packet(gpio_configuration_packet_t* gpio_configuration_packet, an_packet_t* an_packet)
+int decode_gpio_configuration_packet_view(gpio_configuration_packet_t* gpio_configuration_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_gpio_configuration && an_packet->length == 13)
 	 {
 		gpio_configuration_packet->permanent = an_packet->data[0];
-		memcpy(gpio_configuration_packet, &an_packet->data[1], 4 * sizeof(uint8_t));
+		memcpy(gpio_configuration_packet->gpio_function, &an_packet->data[1], 4 * sizeof(uint8_t));
 		gpio_configuration_packet->gpio_voltage_selection = an_packet->data[5];
 		return 0;
 	}
 	else return 1;
 }
 
+int encode_gpio_configuration_packet_into(uint8_t* buffer, size_t capacity, gpio_configuration_packet_t* gpio_configuration_packet)
+{
+	an_packet_view_t an_packet;
+	if(!an_packet_view_initialise(&an_packet, buffer, capacity, 13, packet_id_gpio_configuration)) return 0;
+	an_packet.data[0] = gpio_configuration_packet->permanent;
+	memcpy(&an_packet.data[1], gpio_configuration_packet->gpio_function, 4 * sizeof(uint8_t));
+	an_packet.data[5] = gpio_configuration_packet->gpio_voltage_selection;
+	memset(&an_packet.data[6], 0, 7 * sizeof(uint8_t));
+	an_packet_view_encode(&an_packet);
+	return AN_PACKET_HEADER_SIZE + an_packet.length;
+}
+
 an_packet_t* encode_gpio_configuration_packet(gpio_configuration_packet_t* gpio_configuration_packet)
 {
 	an_packet_t* an_packet = an_packet_allocate(13, packet_id_gpio_configuration);
-	if(an_packet != NULL)
-	 {
-		an_packet->data[0] = gpio_configuration_packet->permanent;
-		memcpy(&an_packet->data[1], gpio_configuration_packet, 4 * sizeof(uint8_t));
-		an_packet->data[5] = gpio_configuration_packet->gpio_voltage_selection;
-		memset(&an_packet->data[6], 0, 7 * sizeof(uint8_t));
-	}
+	if(an_packet != NULL) encode_gpio_configuration_packet_into(an_packet->header, AN_PACKET_HEADER_SIZE + an_packet->length, gpio_configuration_packet);
 	return an_packet;
 }
 
-int decode_odometer_configuration_packet(odometer_configuration_packet_t* odometer_configuration_packet, an_packet_t* an_packet)
+int decode_odometer_configuration_packet_view(odometer_configuration_packet_t* odometer_configuration_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_odometer_configuration && an_packet->length == 8)
 	 {
@@ -1247,32 +1467,44 @@ int decode_odometer_configuration_packet(odometer_configuration_packet_t* odomet
 	else return 1;
 }
 
+int encode_odometer_configuration_packet_into(uint8_t* buffer, size_t capacity, odometer_configuration_packet_t* odometer_configuration_packet)
+{
+	an_packet_view_t an_packet;
+	if(!an_packet_view_initialise(&an_packet, buffer, capacity, 8, packet_id_odometer_configuration)) return 0;
+	an_packet.data[0] = odometer_configuration_packet->permanent;
+	an_packet.data[1] = odometer_configuration_packet->automatic_calibration;
+	memset(&an_packet.data[2], 0, 2 * sizeof(uint8_t));
+	memcpy(&an_packet.data[4], &odometer_configuration_packet->pulse_length, sizeof(float));
+	an_packet_view_encode(&an_packet);
+	return AN_PACKET_HEADER_SIZE + an_packet.length;
+}
+
 an_packet_t* encode_odometer_configuration_packet(odometer_configuration_packet_t* odometer_configuration_packet)
 {
 	an_packet_t* an_packet = an_packet_allocate(8, packet_id_odometer_configuration);
-	if(an_packet != NULL)
-	 {
-		an_packet->data[0] = odometer_configuration_packet->permanent;
-		an_packet->data[1] = odometer_configuration_packet->automatic_calibration;
-		memset(&an_packet->data[2], 0, 2 * sizeof(uint8_t));
-		memcpy(&an_packet->data[4], &odometer_configuration_packet->pulse_length, sizeof(float));
-	}
+	if(an_packet != NULL) encode_odometer_configuration_packet_into(an_packet->header, AN_PACKET_HEADER_SIZE + an_packet->length, odometer_configuration_packet);
 	return an_packet;
 }
 
-an_packet_t* encode_zero_alignment_packet(zero_alignment_packet_t* zero_alignment_packet)
+int encode_zero_alignment_packet_into(uint8_t* buffer, size_t capacity, zero_alignment_packet_t* zero_alignment_packet)
 {
 	uint32_t verification = 0x9A4E8055;
+	an_packet_view_t an_packet;
+	if(!an_packet_view_initialise(&an_packet, buffer, capacity, 5, packet_id_zero_alignment)) return 0;
+	an_packet.data[0] = zero_alignment_packet->permanent;
+	memcpy(&an_packet.data[1], &verification, sizeof(uint32_t));
+	an_packet_view_encode(&an_packet);
+	return AN_PACKET_HEADER_SIZE + an_packet.length;
+}
+
+an_packet_t* encode_zero_alignment_packet(zero_alignment_packet_t* zero_alignment_packet)
+{
 	an_packet_t* an_packet = an_packet_allocate(5, packet_id_zero_alignment);
-	if(an_packet != NULL)
-	 {
-		an_packet->data[0] = zero_alignment_packet->permanent;
-		memcpy(&an_packet->data[1], &verification, sizeof(uint32_t));
-	}
+	if(an_packet != NULL) encode_zero_alignment_packet_into(an_packet->header, AN_PACKET_HEADER_SIZE + an_packet->length, zero_alignment_packet);
 	return an_packet;
 }
 
-int decode_heave_offset_packet(heave_offset_packet_t* heave_offset_packet, an_packet_t* an_packet)
+int decode_heave_offset_packet_view(heave_offset_packet_t* heave_offset_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_reference_offsets && an_packet->length == 49)
 	 {
@@ -1286,21 +1518,27 @@ int decode_heave_offset_packet(heave_offset_packet_t* heave_offset_packet, an_pa
 	else return 1;
 }
 
+int encode_heave_offset_packet_into(uint8_t* buffer, size_t capacity, heave_offset_packet_t* heave_offset_packet)
+{
+	an_packet_view_t an_packet;
+	if(!an_packet_view_initialise(&an_packet, buffer, capacity, 49, packet_id_reference_offsets)) return 0;
+	an_packet.data[0] = heave_offset_packet->permanent;
+	memcpy(&an_packet.data[1], &heave_offset_packet->heave_point_1_offset[0], 3 * sizeof(float));
+	memcpy(&an_packet.data[13], &heave_offset_packet->heave_point_2_offset[0], 3 * sizeof(float));
+	memcpy(&an_packet.data[25], &heave_offset_packet->heave_point_3_offset[0], 3 * sizeof(float));
+	memcpy(&an_packet.data[37], &heave_offset_packet->heave_point_4_offset[0], 3 * sizeof(float));
+	an_packet_view_encode(&an_packet);
+	return AN_PACKET_HEADER_SIZE + an_packet.length;
+}
+
 an_packet_t* encode_heave_offset_packet(heave_offset_packet_t* heave_offset_packet)
 {
 	an_packet_t* an_packet = an_packet_allocate(49, packet_id_reference_offsets);
-	if(an_packet != NULL)
-	 {
-		an_packet->data[0] = heave_offset_packet->permanent;
-		memcpy(&an_packet->data[1], &heave_offset_packet->heave_point_1_offset[0], 3 * sizeof(float));
-		memcpy(&an_packet->data[13], &heave_offset_packet->heave_point_2_offset[0], 3 * sizeof(float));
-		memcpy(&an_packet->data[25], &heave_offset_packet->heave_point_3_offset[0], 3 * sizeof(float));
-		memcpy(&an_packet->data[37], &heave_offset_packet->heave_point_4_offset[0], 3 * sizeof(float));
-	}
+	if(an_packet != NULL) encode_heave_offset_packet_into(an_packet->header, AN_PACKET_HEADER_SIZE + an_packet->length, heave_offset_packet);
 	return an_packet;
 }
 
-int decode_gpio_output_configuration_packet(gpio_output_configuration_packet_t* gpio_output_configuration_packet, an_packet_t* an_packet)
+int decode_gpio_output_configuration_packet_view(gpio_output_configuration_packet_t* gpio_output_configuration_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_gpio_output_configuration && an_packet->length == 183)
 	 {
@@ -1317,31 +1555,37 @@ int decode_gpio_output_configuration_packet(gpio_output_configuration_packet_t*
 	else return 1;
 }
 
+int encode_gpio_output_configuration_packet_into(uint8_t* buffer, size_t capacity, gpio_output_configuration_packet_t* gpio_output_configuration_packet)
+{
+	an_packet_view_t an_packet;
+	if(!an_packet_view_initialise(&an_packet, buffer, capacity, 183, packet_id_gpio_output_configuration)) return 0;
+	an_packet.data[0] = gpio_output_configuration_packet->permanent;
+	memcpy(&an_packet.data[1], &gpio_output_configuration_packet->auxiliary_port, 18 * sizeof(uint8_t));
+	memset(&an_packet.data[19], 0, 8 * sizeof(uint8_t));
+	memcpy(&an_packet.data[27], &gpio_output_configuration_packet->gpio_port, 18 * sizeof(uint8_t));
+	memset(&an_packet.data[45], 0, 8 * sizeof(uint8_t));
+	memcpy(&an_packet.data[53], &gpio_output_configuration_packet->logging_port, 18 * sizeof(uint8_t));
+	memset(&an_packet.data[71], 0, 8 * sizeof(uint8_t));
+	memcpy(&an_packet.data[79], &gpio_output_configuration_packet->data_port_1, 18 * sizeof(uint8_t));
+	memset(&an_packet.data[97], 0, 8 * sizeof(uint8_t));
+	memcpy(&an_packet.data[105], &gpio_output_configuration_packet->data_port_2, 18 * sizeof(uint8_t));
+	memset(&an_packet.data[123], 0, 8 * sizeof(uint8_t));
+	memcpy(&an_packet.data[131], &gpio_output_configuration_packet->data_port_3, 18 * sizeof(uint8_t));
+	memset(&an_packet.data[149], 0, 8 * sizeof(uint8_t));
+	memcpy(&an_packet.data[157], &gpio_output_configuration_packet->data_port_4, 18 * sizeof(uint8_t));
+	memset(&an_packet.data[175], 0, 8 * sizeof(uint8_t));
+	an_packet_view_encode(&an_packet);
+	return AN_PACKET_HEADER_SIZE + an_packet.length;
+}
+
 an_packet_t* encode_gpio_output_configuration_packet(gpio_output_configuration_packet_t* gpio_output_configuration_packet)
 {
 	an_packet_t* an_packet = an_packet_allocate(183, packet_id_gpio_output_configuration);
-	if(an_packet != NULL)
-	 {
-		an_packet->data[0] = gpio_output_configuration_packet->permanent;
-		memcpy(&an_packet->data[1], &gpio_output_configuration_packet->auxiliary_port, 18 * sizeof(uint8_t));
-		memset(&an_packet->data[19], 0, 8 * sizeof(uint8_t));
-		memcpy(&an_packet->data[27], &gpio_output_configuration_packet->gpio_port, 18 * sizeof(uint8_t));
-		memset(&an_packet->data[45], 0, 8 * sizeof(uint8_t));
-		memcpy(&an_packet->data[53], &gpio_output_configuration_packet->logging_port, 18 * sizeof(uint8_t));
-		memset(&an_packet->data[71], 0, 8 * sizeof(uint8_t));
-		memcpy(&an_packet->data[79], &gpio_output_configuration_packet->data_port_1, 18 * sizeof(uint8_t));
-		memset(&an_packet->data[97], 0, 8 * sizeof(uint8_t));
-		memcpy(&an_packet->data[105], &gpio_output_configuration_packet->data_port_2, 18 * sizeof(uint8_t));
-		memset(&an_packet->data[123], 0, 8 * sizeof(uint8_t));
-		memcpy(&an_packet->data[131], &gpio_output_configuration_packet->data_port_3, 18 * sizeof(uint8_t));
-		memset(&an_packet->data[149], 0, 8 * sizeof(uint8_t));
-		memcpy(&an_packet->data[157], &gpio_output_configuration_packet->data_port_4, 18 * sizeof(uint8_t));
-		memset(&an_packet->data[175], 0, 8 * sizeof(uint8_t));
-	}
+	if(an_packet != NULL) encode_gpio_output_configuration_packet_into(an_packet->header, AN_PACKET_HEADER_SIZE + an_packet->length, gpio_output_configuration_packet);
 	return an_packet;
 }
 
-int decode_dual_antenna_configuration_packet(dual_antenna_configuration_packet_t* dual_antenna_configuration_packet, an_packet_t* an_packet)
+int decode_dual_antenna_configuration_packet_view(dual_antenna_configuration_packet_t* dual_antenna_configuration_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_dual_antenna_configuration && an_packet->length == 17)
 	 {
@@ -1355,21 +1599,27 @@ int decode_dual_antenna_configuration_packet(dual_antenna_configuration_packet_t
 	return 1;
 }
 
+int encode_dual_antenna_configuration_packet_into(uint8_t* buffer, size_t capacity, dual_antenna_configuration_packet_t* dual_antenna_configuration_packet)
+{
+	an_packet_view_t an_packet;
+	if(!an_packet_view_initialise(&an_packet, buffer, capacity, 17, packet_id_dual_antenna_configuration)) return 0;
+	an_packet.data[0] = dual_antenna_configuration_packet->permanent;
+	memcpy(&an_packet.data[1], &dual_antenna_configuration_packet->options.r, sizeof(uint16_t));
+	an_packet.data[3] = dual_antenna_configuration_packet->automatic_offset_orientation;
+	an_packet.data[4] = 0;
+	memcpy(&an_packet.data[5], &dual_antenna_configuration_packet->manual_offset, 3 * sizeof(float));
+	an_packet_view_encode(&an_packet);
+	return AN_PACKET_HEADER_SIZE + an_packet.length;
+}
+
 an_packet_t* encode_dual_antenna_configuration_packet(dual_antenna_configuration_packet_t* dual_antenna_configuration_packet)
 {
 	an_packet_t* an_packet = an_packet_allocate(17, packet_id_dual_antenna_configuration);
-	if(an_packet != NULL)
-	 {
-		an_packet->data[0] = dual_antenna_configuration_packet->permanent;
-		memcpy(&an_packet->data[1], &dual_antenna_configuration_packet->options.r, sizeof(uint16_t));
-		an_packet->data[3] = dual_antenna_configuration_packet->automatic_offset_orientation;
-		an_packet->data[4] = 0;
-		memcpy(&an_packet->data[5], &dual_antenna_configuration_packet->manual_offset, 3 * sizeof(float));
-	}
+	if(an_packet != NULL) encode_dual_antenna_configuration_packet_into(an_packet->header, AN_PACKET_HEADER_SIZE + an_packet->length, dual_antenna_configuration_packet);
 	return an_packet;
 }
 
-int decode_gnss_configuration_packet(gnss_configuration_packet_t* gnss_configuration_packet, an_packet_t* an_packet)
+int decode_gnss_configuration_packet_view(gnss_configuration_packet_t* gnss_configuration_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_gnss_configuration && an_packet->length == 85)
 	 {
@@ -1391,29 +1641,36 @@ int decode_gnss_configuration_packet(gnss_configuration_packet_t* gnss_configura
 	return 1;
 }
 
+int encode_gnss_configuration_packet_into(uint8_t* buffer, size_t capacity, gnss_configuration_packet_t* gnss_configuration_packet)
+{
+	an_packet_view_t an_packet;
+	if(!an_packet_view_initialise(&an_packet, buffer, capacity, 85, packet_id_gnss_configuration)) return 0;
+	an_packet.data[0] = gnss_configuration_packet->permanent;
+	memcpy(&an_packet.data[1], &gnss_configuration_packet->gnss_frequencies, sizeof(uint64_t));
+	memcpy(&an_packet.data[9], &gnss_configuration_packet->pdop, sizeof(float));
+	memcpy(&an_packet.data[13], &gnss_configuration_packet->tdop, sizeof(float));
+	an_packet.data[17] = gnss_configuration_packet->elevation_mask;
+	an_packet.data[18] = gnss_configuration_packet->snr_mask;
+	an_packet.data[19] = gnss_configuration_packet->sbas_corrections_enabled;
+	an_packet.data[20] = gnss_configuration_packet->lband_mode;
+	memcpy(&an_packet.data[21], &gnss_configuration_packet->lband_frequency, sizeof(uint32_t));
+	memcpy(&an_packet.data[25], &gnss_configuration_packet->lband_baud, sizeof(uint32_t));
+	memcpy(&an_packet.data[29], &gnss_configuration_packet->primary_antenna_type, sizeof(uint32_t));
+	memcpy(&an_packet.data[33], &gnss_configuration_packet->secondary_antenna_type, sizeof(uint32_t));
+	an_packet.data[37] = gnss_configuration_packet->lband_satellite_id;
+	memset(&an_packet.data[38], 0, 47 * sizeof(uint8_t));
+	an_packet_view_encode(&an_packet);
+	return AN_PACKET_HEADER_SIZE + an_packet.length;
+}
+
 an_packet_t* encode_gnss_configuration_packet(gnss_configuration_packet_t* gnss_configuration_packet)
 {
 	an_packet_t* an_packet = an_packet_allocate(85, packet_id_gnss_configuration);
-	if(an_packet != NULL)
-	 {
-		an_packet->data[0] = gnss_configuration_packet->permanent;
-		memcpy(&an_packet->data[1], &gnss_configuration_packet->gnss_frequencies, sizeof(uint64_t));
-		memcpy(&an_packet->data[9], &gnss_configuration_packet->pdop, sizeof(float));
-		memcpy(&an_packet->data[13], &gnss_configuration_packet->tdop, sizeof(float));
-		an_packet->data[17] = gnss_configuration_packet->elevation_mask;
-		an_packet->data[18] = gnss_configuration_packet->snr_mask;
-		an_packet->data[19] = gnss_configuration_packet->sbas_corrections_enabled;
-		an_packet->data[20] = gnss_configuration_packet->lband_mode;
-		memcpy(&an_packet->data[21], &gnss_configuration_packet->lband_frequency, sizeof(uint32_t));
-		memcpy(&an_packet->data[25], &gnss_configuration_packet->lband_baud, sizeof(uint32_t));
-		memcpy(&an_packet->data[29], &gnss_configuration_packet->primary_antenna_type, sizeof(uint32_t));
-		memcpy(&an_packet->data[33], &gnss_configuration_packet->secondary_antenna_type, sizeof(uint32_t));
-		an_packet->data[37] = gnss_configuration_packet->lband_satellite_id;
-	}
+	if(an_packet != NULL) encode_gnss_configuration_packet_into(an_packet->header, AN_PACKET_HEADER_SIZE + an_packet->length, gnss_configuration_packet);
 	return an_packet;
 }
 
-int decode_user_data_packet(user_data_packet_t* user_data_packet, an_packet_t* an_packet)
+int decode_user_data_packet_view(user_data_packet_t* user_data_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_user_data && an_packet->length == 64)
 	 {
@@ -1423,17 +1680,23 @@ int decode_user_data_packet(user_data_packet_t* user_data_packet, an_packet_t* a
 	return 1;
 }
 
+int encode_user_data_packet_into(uint8_t* buffer, size_t capacity, user_data_packet_t* user_data_packet)
+{
+	an_packet_view_t an_packet;
+	if(!an_packet_view_initialise(&an_packet, buffer, capacity, 64, packet_id_user_data)) return 0;
+	memcpy(&an_packet.data[0], &user_data_packet->user_data, 64);
+	an_packet_view_encode(&an_packet);
+	return AN_PACKET_HEADER_SIZE + an_packet.length;
+}
+
 an_packet_t* encode_user_data_packet(user_data_packet_t* user_data_packet)
 {
 	an_packet_t* an_packet = an_packet_allocate(64, packet_id_user_data);
-	if(an_packet != NULL)
-	 {
-		memcpy(&an_packet->data[0], &user_data_packet->user_data, 64);
-	}
+	if(an_packet != NULL) encode_user_data_packet_into(an_packet->header, AN_PACKET_HEADER_SIZE + an_packet->length, user_data_packet);
 	return an_packet;
 }
 
-int decode_gpio_input_configuration_packet(gpio_input_configuration_packet_t* gpio_input_configuration_packet, an_packet_t* an_packet)
+int decode_gpio_input_configuration_packet_view(gpio_input_configuration_packet_t* gpio_input_configuration_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_gpio_input_configuration && an_packet->length == 65)
 	 {
@@ -1444,18 +1707,25 @@ int decode_gpio_input_configuration_packet(gpio_input_configuration_packet_t* gp
 	return 1;
 }
 
+int encode_gpio_input_configuration_packet_into(uint8_t* buffer, size_t capacity, gpio_input_configuration_packet_t* gpio_input_configuration_packet)
+{
+	an_packet_view_t an_packet;
+	if(!an_packet_view_initialise(&an_packet, buffer, capacity, 65, packet_id_gpio_input_configuration)) return 0;
+	an_packet.data[0] = gpio_input_configuration_packet->permanent;
+	memcpy(&an_packet.data[1], &gpio_input_configuration_packet->gimbal_radians_per_encoder_tick, sizeof(float));
+	memset(&an_packet.data[5], 0, 60 * sizeof(uint8_t));
+	an_packet_view_encode(&an_packet);
+	return AN_PACKET_HEADER_SIZE + an_packet.length;
+}
+
 an_packet_t* encode_gpio_input_configuration_packet(gpio_input_configuration_packet_t* gpio_input_configuration_packet)
 {
 	an_packet_t* an_packet = an_packet_allocate(65, packet_id_gpio_input_configuration);
-	if(an_packet != NULL)
-	 {
-		an_packet->data[0] = gpio_input_configuration_packet->permanent;
-		memcpy(&an_packet->data[1], &gpio_input_configuration_packet->gimbal_radians_per_encoder_tick, sizeof(float));
-	}
+	if(an_packet != NULL) encode_gpio_input_configuration_packet_into(an_packet->header, AN_PACKET_HEADER_SIZE + an_packet->length, gpio_input_configuration_packet);
 	return an_packet;
 }
 
-int decode_ip_dataports_configuration_packet(ip_dataports_configuration_packet_t* ip_dataports_configuration_packet, an_packet_t* an_packet)
+int decode_ip_dataports_configuration_packet_view(ip_dataports_configuration_packet_t* ip_dataports_configuration_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_ip_dataports_configuration && an_packet->length == 30)
 	 {
@@ -1470,22 +1740,29 @@ int decode_ip_dataports_configuration_packet(ip_dataports_configuration_packet_t
 	return 1;
 }
 
-an_packet_t* encode_ip_dataports_configuration_packet(ip_dataports_configuration_packet_t* ip_dataports_configuration_packet)
+int encode_ip_dataports_configuration_packet_into(uint8_t* buffer, size_t capacity, ip_dataports_configuration_packet_t* ip_dataports_configuration_packet)
 {
-	an_packet_t* an_packet = an_packet_allocate(30, packet_id_ip_dataports_configuration);
-	if(an_packet != NULL)
+	an_packet_view_t an_packet;
+	if(!an_packet_view_initialise(&an_packet, buffer, capacity, 30, packet_id_ip_dataports_configuration)) return 0;
+	memset(&an_packet.data[0], 0, 2 * sizeof(uint8_t));
+	for(int i = 0; i < 4; i++)
 	 {
-		for(int i = 0; i < 4; i++)
-		 {
-			memcpy(&an_packet->data[7 * i + 2], &ip_dataports_configuration_packet->ip_dataport_configuration[i].ip_address, sizeof(uint32_t));
-			memcpy(&an_packet->data[7 * i + 6], &ip_dataports_configuration_packet->ip_dataport_configuration[i].port, sizeof(uint16_t));
-			an_packet->data[7 * i + 8] = ip_dataports_configuration_packet->ip_dataport_configuration[i].ip_dataport_mode;
-		}
+		memcpy(&an_packet.data[7 * i + 2], &ip_dataports_configuration_packet->ip_dataport_configuration[i].ip_address, sizeof(uint32_t));
+		memcpy(&an_packet.data[7 * i + 6], &ip_dataports_configuration_packet->ip_dataport_configuration[i].port, sizeof(uint16_t));
+		an_packet.data[7 * i + 8] = ip_dataports_configuration_packet->ip_dataport_configuration[i].ip_dataport_mode;
 	}
+	an_packet_view_encode(&an_packet);
+	return AN_PACKET_HEADER_SIZE + an_packet.length;
+}
+
+an_packet_t* encode_ip_dataports_configuration_packet(ip_dataports_configuration_packet_t* ip_dataports_configuration_packet)
+{
+	an_packet_t* an_packet = an_packet_allocate(30, packet_id_ip_dataports_configuration);
+	if(an_packet != NULL) encode_ip_dataports_configuration_packet_into(an_packet->header, AN_PACKET_HEADER_SIZE + an_packet->length, ip_dataports_configuration_packet);
 	return an_packet;
 }
 
-int decode_can_configuration_packet(can_configuration_packet_t* can_configuration_packet, an_packet_t* an_packet)
+int decode_can_configuration_packet_view(can_configuration_packet_t* can_configuration_packet, const an_packet_view_t* an_packet)
 {
 	if(an_packet->id == packet_id_can_configuration && an_packet->length == 11)
 	 {
@@ -1498,16 +1775,502 @@ int decode_can_configuration_packet(can_configuration_packet_t* can_configuratio
 	return 1;
 }
 
+int encode_can_configuration_packet_into(uint8_t* buffer, size_t capacity, can_configuration_packet_t* can_configuration_packet)
+{
+	an_packet_view_t an_packet;
+	if(!an_packet_view_initialise(&an_packet, buffer, capacity, 11, packet_id_can_configuration)) return 0;
+	an_packet.data[0] = can_configuration_packet->permanent;
+	an_packet.data[1] = can_configuration_packet->enabled;
+	memcpy(&an_packet.data[2], &can_configuration_packet->baud_rate, sizeof(uint32_t));
+	an_packet.data[6] = can_configuration_packet->can_protocol;
+	memset(&an_packet.data[7], 0, 4 * sizeof(uint8_t));
+	an_packet_view_encode(&an_packet);
+	return AN_PACKET_HEADER_SIZE + an_packet.length;
+}
+
 an_packet_t* encode_can_configuration_packet(can_configuration_packet_t* can_configuration_packet)
 {
 	an_packet_t* an_packet = an_packet_allocate(11, packet_id_can_configuration);
-	if(an_packet != NULL)
-	 {
-		an_packet->data[0] = can_configuration_packet->permanent;
-		an_packet->data[1] = can_configuration_packet->enabled;
-		memcpy(&an_packet->data[2], &can_configuration_packet->baud_rate, sizeof(uint32_t));
-		an_packet->data[6] = can_configuration_packet->can_protocol;
-	}
+	if(an_packet != NULL) encode_can_configuration_packet_into(an_packet->header, AN_PACKET_HEADER_SIZE + an_packet->length, can_configuration_packet);
 	return an_packet;
 }
 
+/*
+ * Decode functions taking an allocated an_packet_t as returned by an_packet_decode()
+ */
+
+int decode_acknowledge_packet(acknowledge_packet_t* acknowledge_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_acknowledge_packet_view(acknowledge_packet, &an_packet_view);
+}
+
+int decode_boot_mode_packet(boot_mode_packet_t* boot_mode_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_boot_mode_packet_view(boot_mode_packet, &an_packet_view);
+}
+
+int decode_device_information_packet(device_information_packet_t* device_information_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_device_information_packet_view(device_information_packet, &an_packet_view);
+}
+
+int decode_file_transfer_acknowledge_packet(file_transfer_acknowledge_packet_t* file_transfer_acknowledge_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_file_transfer_acknowledge_packet_view(file_transfer_acknowledge_packet, &an_packet_view);
+}
+
+int decode_serial_port_passthrough_packet(serial_port_passthrough_packet_t* serial_port_passthrough_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_serial_port_passthrough_packet_view(serial_port_passthrough_packet, &an_packet_view);
+}
+
+int decode_ip_configuration_packet(ip_configuration_packet_t* ip_configuration_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_ip_configuration_packet_view(ip_configuration_packet, &an_packet_view);
+}
+
+int decode_subcomponent_information_packet(subcomponent_information_packet_t* subcomponent_information_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_subcomponent_information_packet_view(subcomponent_information_packet, &an_packet_view);
+}
+
+int decode_system_state_packet(system_state_packet_t* system_state_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_system_state_packet_view(system_state_packet, &an_packet_view);
+}
+
+int decode_unix_time_packet(unix_time_packet_t* unix_time_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_unix_time_packet_view(unix_time_packet, &an_packet_view);
+}
+
+int decode_formatted_time_packet(formatted_time_packet_t* formatted_time_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_formatted_time_packet_view(formatted_time_packet, &an_packet_view);
+}
+
+int decode_status_packet(status_packet_t* status_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_status_packet_view(status_packet, &an_packet_view);
+}
+
+int decode_position_standard_deviation_packet(position_standard_deviation_packet_t* position_standard_deviation_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_position_standard_deviation_packet_view(position_standard_deviation_packet, &an_packet_view);
+}
+
+int decode_velocity_standard_deviation_packet(velocity_standard_deviation_packet_t* velocity_standard_deviation_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_velocity_standard_deviation_packet_view(velocity_standard_deviation_packet, &an_packet_view);
+}
+
+int decode_euler_orientation_standard_deviation_packet(euler_orientation_standard_deviation_packet_t* euler_orientation_standard_deviation, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_euler_orientation_standard_deviation_packet_view(euler_orientation_standard_deviation, &an_packet_view);
+}
+
+int decode_quaternion_orientation_standard_deviation_packet(quaternion_orientation_standard_deviation_packet_t* quaternion_orientation_standard_deviation_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_quaternion_orientation_standard_deviation_packet_view(quaternion_orientation_standard_deviation_packet, &an_packet_view);
+}
+
+int decode_raw_sensors_packet(raw_sensors_packet_t* raw_sensors_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_raw_sensors_packet_view(raw_sensors_packet, &an_packet_view);
+}
+
+int decode_raw_gnss_packet(raw_gnss_packet_t* raw_gnss_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_raw_gnss_packet_view(raw_gnss_packet, &an_packet_view);
+}
+
+int decode_satellites_packet(satellites_packet_t* satellites_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_satellites_packet_view(satellites_packet, &an_packet_view);
+}
+
+int decode_geodetic_position_packet(geodetic_position_packet_t* geodetic_position_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_geodetic_position_packet_view(geodetic_position_packet, &an_packet_view);
+}
+
+int decode_ecef_position_packet(ecef_position_packet_t* ecef_position_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_ecef_position_packet_view(ecef_position_packet, &an_packet_view);
+}
+
+int decode_utm_position_packet(utm_position_packet_t* utm_position_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_utm_position_packet_view(utm_position_packet, &an_packet_view);
+}
+
+int decode_ned_velocity_packet(ned_velocity_packet_t* ned_velocity_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_ned_velocity_packet_view(ned_velocity_packet, &an_packet_view);
+}
+
+int decode_body_velocity_packet(body_velocity_packet_t* body_velocity_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_body_velocity_packet_view(body_velocity_packet, &an_packet_view);
+}
+
+int decode_acceleration_packet(acceleration_packet_t* acceleration, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_acceleration_packet_view(acceleration, &an_packet_view);
+}
+
+int decode_body_acceleration_packet(body_acceleration_packet_t* body_acceleration, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_body_acceleration_packet_view(body_acceleration, &an_packet_view);
+}
+
+int decode_euler_orientation_packet(euler_orientation_packet_t* euler_orientation_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_euler_orientation_packet_view(euler_orientation_packet, &an_packet_view);
+}
+
+int decode_quaternion_orientation_packet(quaternion_orientation_packet_t* quaternion_orientation_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_quaternion_orientation_packet_view(quaternion_orientation_packet, &an_packet_view);
+}
+
+int decode_dcm_orientation_packet(dcm_orientation_packet_t* dcm_orientation_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_dcm_orientation_packet_view(dcm_orientation_packet, &an_packet_view);
+}
+
+int decode_angular_velocity_packet(angular_velocity_packet_t* angular_velocity_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_angular_velocity_packet_view(angular_velocity_packet, &an_packet_view);
+}
+
+int decode_angular_acceleration_packet(angular_acceleration_packet_t* angular_acceleration_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_angular_acceleration_packet_view(angular_acceleration_packet, &an_packet_view);
+}
+
+int decode_external_position_velocity_packet(external_position_velocity_packet_t* external_position_velocity_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_external_position_velocity_packet_view(external_position_velocity_packet, &an_packet_view);
+}
+
+int decode_external_position_packet(external_position_packet_t* external_position_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_external_position_packet_view(external_position_packet, &an_packet_view);
+}
+
+int decode_external_velocity_packet(external_velocity_packet_t* external_velocity_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_external_velocity_packet_view(external_velocity_packet, &an_packet_view);
+}
+
+int decode_external_body_velocity_packet(external_body_velocity_packet_t* external_body_velocity_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_external_body_velocity_packet_view(external_body_velocity_packet, &an_packet_view);
+}
+
+int decode_external_heading_packet(external_heading_packet_t* external_heading_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_external_heading_packet_view(external_heading_packet, &an_packet_view);
+}
+
+int decode_running_time_packet(running_time_packet_t* running_time_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_running_time_packet_view(running_time_packet, &an_packet_view);
+}
+
+int decode_local_magnetics_packet(local_magnetics_packet_t* local_magnetics_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_local_magnetics_packet_view(local_magnetics_packet, &an_packet_view);
+}
+
+int decode_odometer_state_packet(odometer_state_packet_t* odometer_state_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_odometer_state_packet_view(odometer_state_packet, &an_packet_view);
+}
+
+int decode_external_time_packet(external_time_packet_t* external_time_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_external_time_packet_view(external_time_packet, &an_packet_view);
+}
+
+int decode_external_depth_packet(external_depth_packet_t* external_depth_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_external_depth_packet_view(external_depth_packet, &an_packet_view);
+}
+
+int decode_geoid_height_packet(geoid_height_packet_t* geoid_height_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_geoid_height_packet_view(geoid_height_packet, &an_packet_view);
+}
+
+int decode_wind_packet(wind_packet_t* wind_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_wind_packet_view(wind_packet, &an_packet_view);
+}
+
+int decode_heave_packet(heave_packet_t* heave_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_heave_packet_view(heave_packet, &an_packet_view);
+}
+
+int decode_raw_satellite_ephemeris_packet(raw_satellite_ephemeris_packet_t* raw_satellite_ephemeris_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_raw_satellite_ephemeris_packet_view(raw_satellite_ephemeris_packet, &an_packet_view);
+}
+
+int decode_external_odometer_packet(odometer_packet_t* external_odometer_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_external_odometer_packet_view(external_odometer_packet, &an_packet_view);
+}
+
+int decode_external_air_data_packet(external_air_data_packet_t* external_air_data_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_external_air_data_packet_view(external_air_data_packet, &an_packet_view);
+}
+
+int decode_gnss_information_packet(gnss_receiver_information_packet_t* gnss_information_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_gnss_information_packet_view(gnss_information_packet, &an_packet_view);
+}
+
+int decode_raw_dvl_data_packet(raw_dvl_data_packet_t* raw_dvl_data_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_raw_dvl_data_packet_view(raw_dvl_data_packet, &an_packet_view);
+}
+
+int decode_north_seeking_status_packet(north_seeking_status_packet_t* north_seeking_status_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_north_seeking_status_packet_view(north_seeking_status_packet, &an_packet_view);
+}
+
+int decode_gimbal_state_packet(gimbal_state_packet_t* gimbal_state_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_gimbal_state_packet_view(gimbal_state_packet, &an_packet_view);
+}
+
+int decode_automotive_packet(automotive_packet_t* automotive_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_automotive_packet_view(automotive_packet, &an_packet_view);
+}
+
+int decode_external_magnetometers_packet(external_magnetometers_packet_t* external_magnetometers_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_external_magnetometers_packet_view(external_magnetometers_packet, &an_packet_view);
+}
+
+int decode_extended_satellites_packet(extended_satellites_packet_t* extended_satellites_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_extended_satellites_packet_view(extended_satellites_packet, &an_packet_view);
+}
+
+int decode_packet_timer_period_packet(packet_timer_period_packet_t* packet_timer_period_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_packet_timer_period_packet_view(packet_timer_period_packet, &an_packet_view);
+}
+
+int decode_packet_periods_packet(packet_periods_packet_t* packet_periods_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_packet_periods_packet_view(packet_periods_packet, &an_packet_view);
+}
+
+int decode_baud_rates_packet(baud_rates_packet_t* baud_rates_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_baud_rates_packet_view(baud_rates_packet, &an_packet_view);
+}
+
+int decode_installation_alignment_packet(installation_alignment_packet_t* installation_alignment_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_installation_alignment_packet_view(installation_alignment_packet, &an_packet_view);
+}
+
+int decode_filter_options_packet(filter_options_packet_t* filter_options_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_filter_options_packet_view(filter_options_packet, &an_packet_view);
+}
+
+int decode_gpio_configuration_packet(gpio_configuration_packet_t* gpio_configuration_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_gpio_configuration_packet_view(gpio_configuration_packet, &an_packet_view);
+}
+
+int decode_odometer_configuration_packet(odometer_configuration_packet_t* odometer_configuration_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_odometer_configuration_packet_view(odometer_configuration_packet, &an_packet_view);
+}
+
+int decode_heave_offset_packet(heave_offset_packet_t* heave_offset_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_heave_offset_packet_view(heave_offset_packet, &an_packet_view);
+}
+
+int decode_gpio_output_configuration_packet(gpio_output_configuration_packet_t* gpio_output_configuration_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_gpio_output_configuration_packet_view(gpio_output_configuration_packet, &an_packet_view);
+}
+
+int decode_dual_antenna_configuration_packet(dual_antenna_configuration_packet_t* dual_antenna_configuration_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_dual_antenna_configuration_packet_view(dual_antenna_configuration_packet, &an_packet_view);
+}
+
+int decode_gnss_configuration_packet(gnss_configuration_packet_t* gnss_configuration_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_gnss_configuration_packet_view(gnss_configuration_packet, &an_packet_view);
+}
+
+int decode_user_data_packet(user_data_packet_t* user_data_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_user_data_packet_view(user_data_packet, &an_packet_view);
+}
+
+int decode_gpio_input_configuration_packet(gpio_input_configuration_packet_t* gpio_input_configuration_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_gpio_input_configuration_packet_view(gpio_input_configuration_packet, &an_packet_view);
+}
+
+int decode_ip_dataports_configuration_packet(ip_dataports_configuration_packet_t* ip_dataports_configuration_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_ip_dataports_configuration_packet_view(ip_dataports_configuration_packet, &an_packet_view);
+}
+
+int decode_can_configuration_packet(can_configuration_packet_t* can_configuration_packet, an_packet_t* an_packet)
+{
+	an_packet_view_t an_packet_view;
+	an_packet_get_view(an_packet, &an_packet_view);
+	return decode_can_configuration_packet_view(can_configuration_packet, &an_packet_view);
+}
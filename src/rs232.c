@@ -31,11 +31,19 @@
 
 */
 
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE // For ppoll
+#endif
+
 #include "rs232.h"
 
 #include <stdio.h>
 #include <string.h>
 
+#if !defined(COM_MAXPATH)
+#define COM_MAXPATH 256
+#endif
+
 #ifdef _WIN32
 
 /*****************************************************************************/
@@ -64,6 +72,7 @@ const char *comPtn = "COM???";
 /*****************************************************************************/
 const char *findPattern(const char *string, const char *pattern, int *value);
 const char *portInternalName(int index);
+void *_OpenPort(const char *name, int baudrate_and_parity);
 
 /*****************************************************************************/
 typedef struct _COMMTIMEOUTS
@@ -129,6 +138,7 @@ bool __stdcall ReadFile(void *hFile, void *lpBuffer, uint32_t nNumberOfBytesToRe
 bool __stdcall CloseHandle(void *hFile);
 
 uint32_t __stdcall GetLastError(void);
+uint64_t __stdcall GetTickCount64(void);
 void __stdcall SetLastError(uint32_t dwErrCode);
 
 uint32_t __stdcall QueryDosDeviceA(const char *lpDeviceName, char *lpTargetPath, uint32_t ucchMax);
@@ -218,8 +228,6 @@ const char *comGetInternalName(int index)
 /*****************************************************************************/
 int comOpen(int index, int baudrate_and_parity)
 {
-    DCB config;
-    COMMTIMEOUTS timeouts;
     if (index < 0 || index >= noDevices)
         return 0;
     // Close if already open
@@ -227,10 +235,20 @@ int comOpen(int index, int baudrate_and_parity)
     if (com->handle)
         comClose(index);
     // Open COM port
-    void *handle = CreateFileA(comGetInternalName(index), GENERIC_READ | GENERIC_WRITE, 0, NULL, OPEN_EXISTING, 0, NULL);
+    void *handle = _OpenPort(comGetInternalName(index), baudrate_and_parity);
     if (handle == INVALID_HANDLE_VALUE)
         return 0;
     com->handle = handle;
+    return 1;
+}
+
+void *_OpenPort(const char *name, int baudrate_and_parity)
+{
+    DCB config;
+    COMMTIMEOUTS timeouts;
+    void *handle = CreateFileA(name, GENERIC_READ | GENERIC_WRITE, 0, NULL, OPEN_EXISTING, 0, NULL);
+    if (handle == INVALID_HANDLE_VALUE)
+        return INVALID_HANDLE_VALUE;
     // Prepare read / write timeouts
     SetupComm(handle, 64, 64);
     timeouts.ReadIntervalTimeout = MAX_DWORD;
@@ -272,7 +290,20 @@ int comOpen(int index, int baudrate_and_parity)
     if (SetCommState(handle, &config) == 0)
     {
         CloseHandle(handle);
+        return INVALID_HANDLE_VALUE;
+    }
+    return handle;
+}
+
+int comOpenLowLatency(int index, int baudrate_and_parity, COMLatency *latency)
+{
+    // Reads already return immediately (ReadIntervalTimeout = MAX_DWORD)
+    if (!comOpen(index, baudrate_and_parity))
         return 0;
+    if (latency)
+    {
+        latency->low_latency = 0;
+        latency->latency_timer = -1;
     }
     return 1;
 }
@@ -413,6 +444,211 @@ int comSetRts(int index, int state)
     return EscapeCommFunction(comDevices[index].handle, state ? SETRTS : CLRRTS);
 }
 
+int comGetBaudRate(int index)
+{
+    DCB config;
+    if (index < 0 || index >= noDevices)
+        return 0;
+    if (!comDevices[index].handle || GetCommState(comDevices[index].handle, &config) == 0)
+        return 0;
+    return (int)config.BaudRate;
+}
+
+int comGetHandle(int index)
+{
+    // Windows handles cannot be waited on by descriptor based event loops.
+    (void)index;
+    return -1;
+}
+
+/*****************************************************************************/
+struct com_handle
+{
+    void *handle;
+    char path[COM_MAXPATH];
+};
+
+int com_enumerate_paths(com_path_callback_t callback, void *context)
+{
+    size_t size = COM_MINDEVNAME;
+    char *list = (char *)malloc(size);
+    if (!list)
+        return 0;
+    SetLastError(0);
+    QueryDosDeviceA(NULL, list, (uint32_t)size);
+    while (GetLastError() == ERROR_INSUFFICIENT_BUFFER)
+    {
+        size *= 2;
+        char *nlist = realloc(list, size);
+        if (!nlist)
+        {
+            free(list);
+            return 0;
+        }
+        list = nlist;
+        SetLastError(0);
+        QueryDosDeviceA(NULL, list, (uint32_t)size);
+    }
+    int port, count = 0;
+    char name[COM_MAXPATH];
+    const char *nlist = findPattern(list, comPtn, &port);
+    while (port > 0)
+    {
+        snprintf(name, sizeof(name), "COM%i", port);
+        callback(name, context);
+        count++;
+        nlist = findPattern(nlist, comPtn, &port);
+    }
+    free(list);
+    return count;
+}
+
+int com_stable_path(const char *path, char *stable, size_t len)
+{
+    // COM port numbers are already assigned per adapter by Windows
+    snprintf(stable, len, "%s", path);
+    return 0;
+}
+
+com_handle_t *com_open_path(const char *path, int baudrate_and_parity)
+{
+    com_handle_t *com = (com_handle_t *)malloc(sizeof(com_handle_t));
+    if (!com)
+        return NULL;
+    snprintf(com->path, sizeof(com->path), "%s", path);
+    // Plain port names are opened through the device namespace
+    char name[COM_MAXPATH];
+    if (strncmp(path, "COM", 3) == 0)
+        snprintf(name, sizeof(name), "//./%s", path);
+    else
+        snprintf(name, sizeof(name), "%s", path);
+    com->handle = _OpenPort(name, baudrate_and_parity);
+    if (com->handle == INVALID_HANDLE_VALUE)
+    {
+        free(com);
+        return NULL;
+    }
+    return com;
+}
+
+com_handle_t *com_open_path_low_latency(const char *path, int baudrate_and_parity, COMLatency *latency)
+{
+    com_handle_t *com = com_open_path(path, baudrate_and_parity);
+    if (com && latency)
+    {
+        latency->low_latency = 0;
+        latency->latency_timer = -1;
+    }
+    return com;
+}
+
+void com_close(com_handle_t *com)
+{
+    if (!com)
+        return;
+    CloseHandle(com->handle);
+    free(com);
+}
+
+int com_write(com_handle_t *com, const unsigned char *buffer, size_t len)
+{
+    uint32_t bytes = 0;
+    WriteFile(com->handle, buffer, (uint32_t)len, &bytes, NULL);
+    return bytes;
+}
+
+int com_read(com_handle_t *com, unsigned char *buffer, size_t len)
+{
+    uint32_t bytes = 0;
+    ReadFile(com->handle, buffer, (uint32_t)len, &bytes, NULL);
+    return bytes;
+}
+
+int com_read_blocking(com_handle_t *com, unsigned char *buffer, size_t len, unsigned timeout)
+{
+    COMMTIMEOUTS timeouts;
+    timeouts.ReadIntervalTimeout = MAX_DWORD;
+    timeouts.ReadTotalTimeoutMultiplier = 0;
+    timeouts.ReadTotalTimeoutConstant = (uint32_t)timeout;
+    timeouts.WriteTotalTimeoutConstant = 0;
+    timeouts.WriteTotalTimeoutMultiplier = 0;
+    SetCommTimeouts(com->handle, &timeouts);
+
+    uint32_t bytes = 0;
+    ReadFile(com->handle, buffer, (uint32_t)len, &bytes, NULL);
+
+    timeouts.ReadTotalTimeoutConstant = 0;
+    SetCommTimeouts(com->handle, &timeouts);
+    return bytes;
+}
+
+int com_read_until(com_handle_t *com, unsigned char *buffer, size_t len, size_t min_bytes, const struct timespec *timeout)
+{
+    COMMTIMEOUTS timeouts;
+    uint64_t deadline = 0;
+    if (min_bytes < 1)
+        min_bytes = 1;
+    if (min_bytes > len)
+        min_bytes = len;
+    if (timeout)
+        deadline = GetTickCount64() + (uint64_t)timeout->tv_sec * 1000 + ((uint64_t)timeout->tv_nsec + 999999) / 1000000;
+
+    size_t received = 0;
+    while (received < min_bytes)
+    {
+        // Return as soon as anything arrives, or when the time left expires
+        uint64_t now = GetTickCount64();
+        if (timeout && now >= deadline)
+            break;
+        timeouts.ReadIntervalTimeout = MAX_DWORD;
+        timeouts.ReadTotalTimeoutMultiplier = MAX_DWORD;
+        timeouts.ReadTotalTimeoutConstant = timeout ? (uint32_t)(deadline - now) : MAX_DWORD - 1;
+        timeouts.WriteTotalTimeoutConstant = 0;
+        timeouts.WriteTotalTimeoutMultiplier = 0;
+        SetCommTimeouts(com->handle, &timeouts);
+
+        uint32_t bytes = 0;
+        if (!ReadFile(com->handle, buffer + received, (uint32_t)(len - received), &bytes, NULL))
+            break;
+        received += bytes;
+    }
+
+    timeouts.ReadIntervalTimeout = MAX_DWORD;
+    timeouts.ReadTotalTimeoutMultiplier = 0;
+    timeouts.ReadTotalTimeoutConstant = 0;
+    SetCommTimeouts(com->handle, &timeouts);
+    return (int)received;
+}
+
+int com_set_dtr(com_handle_t *com, int state)
+{
+    return EscapeCommFunction(com->handle, state ? SETDTR : CLRDTR);
+}
+
+int com_set_rts(com_handle_t *com, int state)
+{
+    return EscapeCommFunction(com->handle, state ? SETRTS : CLRRTS);
+}
+
+int com_get_baudrate(com_handle_t *com)
+{
+    DCB config;
+    if (GetCommState(com->handle, &config) == 0)
+        return 0;
+    return (int)config.BaudRate;
+}
+
+int com_get_fd(com_handle_t *com)
+{
+    (void)com;
+    return -1;
+}
+
+const char *com_get_path(com_handle_t *com)
+{
+    return com->path;
+}
+
 #endif // _WIN32
 
 #if defined(__unix__) || defined(__unix) || \
@@ -433,6 +669,36 @@ int comSetRts(int index, int state)
 #endif
 #include <stdlib.h>
 #include <sys/ioctl.h>
+#include <poll.h>
+#include <errno.h>
+#include <limits.h>
+#if defined(__linux__)
+#include <linux/serial.h>
+#endif
+
+/*****************************************************************************/
+/** termios2 allows any baud rate through BOTHER. The structure is not exposed
+ *  by the C library and including the kernel header clashes with termios.h,
+ *  so it is declared here for architectures using the generic layout. */
+#if defined(__linux__) && defined(TCGETS2) &&                                  \
+    (defined(__x86_64__) || defined(__i386__) || defined(__arm__) ||           \
+     defined(__aarch64__) || defined(__riscv))
+#define COM_HAS_TERMIOS2
+struct termios2
+{
+    tcflag_t c_iflag;
+    tcflag_t c_oflag;
+    tcflag_t c_cflag;
+    tcflag_t c_lflag;
+    cc_t c_line;
+    cc_t c_cc[19];
+    speed_t c_ispeed;
+    speed_t c_ospeed;
+};
+#if !defined(BOTHER)
+#define BOTHER 0010000
+#endif
+#endif
 
 /*****************************************************************************/
 /** Base name for COM devices */
@@ -451,6 +717,7 @@ typedef struct
 {
     char *port;
     int handle;
+    int baudrate;
 } COMDevice;
 
 #if !defined(COM_MAXDEVICES)
@@ -459,10 +726,28 @@ typedef struct
 static COMDevice comDevices[COM_MAXDEVICES];
 static int noDevices = 0;
 
+#if !defined(COM_LATENCY_TIMER_MS)
+#define COM_LATENCY_TIMER_MS 1
+#endif
+
+/** Stable links to USB serial adapters maintained by udev */
+#define COM_BY_ID_DIR "/dev/serial/by-id"
+
+/** Largest difference between the requested and achieved baud rate */
+#if !defined(COM_BAUD_TOLERANCE_PERCENT)
+#define COM_BAUD_TOLERANCE_PERCENT 3
+#endif
+
 /*****************************************************************************/
 /** Private functions */
 void _AppendDevices(const char *base);
 int _BaudFlag(int BaudRate);
+int _SetLowLatency(int handle);
+int _SetLatencyTimer(const char *port, int milliseconds);
+int _SetBaudRate(int handle, int baudrate);
+int _OpenPort(const char *path, int baudrate_and_parity, int *baudrate);
+int _ConfigureLowLatency(int handle, const char *port, COMLatency *latency);
+void _DevicePath(const char *path, char *device, size_t len);
 
 /*****************************************************************************/
 int comEnumerate()
@@ -533,10 +818,34 @@ int comOpen(int index, int baudrate_and_parity)
         comClose(index);
     // Open port
     printf("Try %s \n", comGetInternalName(index));
-    int handle = open(comGetInternalName(index), O_RDWR | O_NOCTTY | O_NDELAY);
+    int baudrate;
+    int handle = _OpenPort(comGetInternalName(index), baudrate_and_parity, &baudrate);
     if (handle < 0)
         return 0;
     printf("Open %s \n", comGetInternalName(index));
+    com->handle = handle;
+    com->baudrate = baudrate;
+    return 1;
+}
+
+int comOpenLowLatency(int index, int baudrate_and_parity, COMLatency *latency)
+{
+    if (!comOpen(index, baudrate_and_parity))
+        return 0;
+    COMDevice *com = &comDevices[index];
+    if (!_ConfigureLowLatency(com->handle, com->port, latency))
+    {
+        comClose(index);
+        return 0;
+    }
+    return 1;
+}
+
+int _OpenPort(const char *path, int baudrate_and_parity, int *baudrate)
+{
+    int handle = open(path, O_RDWR | O_NOCTTY | O_NDELAY);
+    if (handle < 0)
+        return -1;
     // General configuration
     struct termios config;
     memset(&config, 0, sizeof(config));
@@ -567,6 +876,9 @@ int comOpen(int index, int baudrate_and_parity)
 #endif
     }
     int flag = _BaudFlag(baudrate_and_parity & BAUDRATE_BITMASK);
+    // B0 would hang up the line, _SetBaudRate() sets rates without a constant
+    if (flag == B0)
+        flag = B9600;
     cfsetospeed(&config, flag);
     cfsetispeed(&config, flag);
     // Timeouts configuration
@@ -577,9 +889,36 @@ int comOpen(int index, int baudrate_and_parity)
     if (tcsetattr(handle, TCSANOW, &config) < 0)
     {
         close(handle);
-        return 0;
+        return -1;
+    }
+    // Rates without a B* constant are set through termios2, then the rate
+    // the driver achieved is checked against the request
+    int requested = baudrate_and_parity & BAUDRATE_BITMASK;
+    int achieved = _SetBaudRate(handle, requested);
+    long difference = (long)achieved - (long)requested;
+    if (difference < 0)
+        difference = -difference;
+    if (achieved <= 0 || difference * 100 > (long)requested * COM_BAUD_TOLERANCE_PERCENT)
+    {
+        printf("Baud rate %d not supported by %s (achieved %d)\n", requested, path, achieved);
+        close(handle);
+        return -1;
+    }
+    *baudrate = achieved;
+    return handle;
+}
+
+int _ConfigureLowLatency(int handle, const char *port, COMLatency *latency)
+{
+    // The port is non-blocking, so VMIN/VTIME never delay a read; what remains
+    // is the driver's receive path and the USB serial latency timer
+    int lowLatency = _SetLowLatency(handle);
+    int latencyTimer = _SetLatencyTimer(port, COM_LATENCY_TIMER_MS);
+    if (latency)
+    {
+        latency->low_latency = lowLatency;
+        latency->latency_timer = latencyTimer;
     }
-    com->handle = handle;
     return 1;
 }
 
@@ -593,6 +932,7 @@ void comClose(int index)
     tcdrain(com->handle);
     close(com->handle);
     com->handle = -1;
+    com->baudrate = 0;
 }
 
 void comCloseAll()
@@ -628,25 +968,19 @@ int comRead(int index, unsigned char *buffer, size_t len)
 
 int comReadBlocking(int index, unsigned char *buffer, size_t len, unsigned timeout)
 {
-    fd_set set;
-    struct timeval to;
-    int rv, res;
-
     if (index >= noDevices || index < 0)
         return 0;
     if (comDevices[index].handle <= 0)
         return 0;
 
-    FD_ZERO(&set); /* clear the set */
-    FD_SET(comDevices[index].handle, &set);
-
-    to.tv_sec = timeout / 1000;
-    to.tv_usec = (timeout % 1000) * 1000;
-
-    rv = select(comDevices[index].handle + 1, &set, NULL, NULL, &to);
-    if (rv <= 0)
+    // poll() rather than select(), which cannot watch descriptors above FD_SETSIZE
+    struct pollfd descriptor;
+    descriptor.fd = comDevices[index].handle;
+    descriptor.events = POLLIN;
+    descriptor.revents = 0;
+    if (poll(&descriptor, 1, (int)timeout) <= 0)
         return 0;
-    res = (int)read(comDevices[index].handle, buffer, len);
+    int res = (int)read(comDevices[index].handle, buffer, len);
     if (res < 0)
         res = 0;
     return res;
@@ -708,6 +1042,11 @@ int _BaudFlag(int BaudRate)
     case 230400:
         return B230400;
         break;
+#if defined(B460800)
+    case 460800:
+        return B460800;
+        break;
+#endif
 #if defined(B500000)
     case 500000:
         return B500000;
@@ -764,12 +1103,92 @@ void _AppendDevices(const char *base)
                 COMDevice *com = &comDevices[noDevices++];
                 com->port = (char *)strdup(dp->d_name);
                 com->handle = -1;
+                com->baudrate = 0;
             }
         }
     }
     closedir(dirp);
 }
 
+int _SetBaudRate(int handle, int baudrate)
+{
+#if defined(COM_HAS_TERMIOS2)
+    struct termios2 config;
+    if (ioctl(handle, TCGETS2, &config) < 0)
+        return 0;
+    // Clearing the input rate makes it follow the output rate
+    config.c_cflag &= ~(CBAUD | CIBAUD);
+    config.c_cflag |= BOTHER;
+    config.c_ospeed = (speed_t)baudrate;
+    config.c_ispeed = (speed_t)baudrate;
+    if (ioctl(handle, TCSETS2, &config) < 0)
+        return 0;
+    // Drivers store the rate their divisor actually produces
+    if (ioctl(handle, TCGETS2, &config) < 0)
+        return 0;
+    return (int)config.c_ospeed;
+#else
+    // Only the fixed rates of _BaudFlag() are available, already applied by comOpen()
+    (void)handle;
+    return _BaudFlag(baudrate) == B0 ? 0 : baudrate;
+#endif
+}
+
+int comGetBaudRate(int index)
+{
+    if (index >= noDevices || index < 0)
+        return 0;
+    if (comDevices[index].handle < 0)
+        return 0;
+    return comDevices[index].baudrate;
+}
+
+int _SetLowLatency(int handle)
+{
+#if defined(__linux__) && defined(ASYNC_LOW_LATENCY)
+    struct serial_struct serial;
+    if (ioctl(handle, TIOCGSERIAL, &serial) < 0)
+        return 0;
+    serial.flags |= ASYNC_LOW_LATENCY;
+    if (ioctl(handle, TIOCSSERIAL, &serial) < 0)
+        return 0;
+    // Report what the driver kept rather than what was asked for
+    if (ioctl(handle, TIOCGSERIAL, &serial) < 0)
+        return 0;
+    return (serial.flags & ASYNC_LOW_LATENCY) ? 1 : 0;
+#else
+    (void)handle;
+    return 0;
+#endif
+}
+
+int _SetLatencyTimer(const char *port, int milliseconds)
+{
+#if defined(__linux__)
+    char path[COM_MAXNAME + 64];
+    int value = -1;
+    snprintf(path, sizeof(path), "/sys/bus/usb-serial/devices/%s/latency_timer", port);
+    // Writing needs permission on the sysfs attribute, reading does not
+    FILE *file = fopen(path, "w");
+    if (file)
+    {
+        fprintf(file, "%d", milliseconds);
+        fclose(file);
+    }
+    file = fopen(path, "r");
+    if (!file)
+        return -1;
+    if (fscanf(file, "%d", &value) != 1)
+        value = -1;
+    fclose(file);
+    return value;
+#else
+    (void)port;
+    (void)milliseconds;
+    return -1;
+#endif
+}
+
 int comSetDtr(int index, int state)
 {
     int cmd = state ? TIOCMBIS : TIOCMBIC;
@@ -792,4 +1211,255 @@ int comSetRts(int index, int state)
     return ioctl(comDevices[index].handle, cmd, &flag) != -1;
 }
 
+int comGetHandle(int index)
+{
+    if (index >= noDevices || index < 0)
+        return -1;
+    return comDevices[index].handle;
+}
+
+/*****************************************************************************/
+struct com_handle
+{
+    int handle;
+    int baudrate;
+    char path[COM_MAXPATH];
+};
+
+int com_enumerate_paths(com_path_callback_t callback, void *context)
+{
+    char path[COM_MAXPATH + 8];
+    int count = 0;
+    DIR *dirp = opendir("/dev");
+    if (!dirp)
+        return 0;
+    // readdir() is safe on a stream private to this call
+    struct dirent *dp;
+    while ((dp = readdir(dirp)))
+    {
+        for (int i = 0; i < noBases; i++)
+        {
+            if (strncmp(devBases[i], dp->d_name, strlen(devBases[i])) == 0)
+            {
+                snprintf(path, sizeof(path), "/dev/%s", dp->d_name);
+                callback(path, context);
+                count++;
+                break;
+            }
+        }
+    }
+    closedir(dirp);
+    return count;
+}
+
+void _DevicePath(const char *path, char *device, size_t len)
+{
+    // Plain port names are looked up in /dev
+    if (strchr(path, '/'))
+        snprintf(device, len, "%s", path);
+    else
+        snprintf(device, len, "/dev/%s", path);
+}
+
+int com_stable_path(const char *path, char *stable, size_t len)
+{
+    char device[COM_MAXPATH];
+    char link[COM_MAXPATH + 32];
+    int found = 0;
+    _DevicePath(path, device, sizeof(device));
+#if defined(__linux__)
+    // udev names each USB serial adapter after its vendor, product and serial
+    // number, which survives being unplugged and enumerated as another ttyUSB
+    char *target = realpath(device, NULL);
+    DIR *dirp = target ? opendir(COM_BY_ID_DIR) : NULL;
+    if (dirp)
+    {
+        struct dirent *dp;
+        while (!found && (dp = readdir(dirp)))
+        {
+            if (dp->d_name[0] == '.')
+                continue;
+            snprintf(link, sizeof(link), "%s/%s", COM_BY_ID_DIR, dp->d_name);
+            char *resolved = realpath(link, NULL);
+            if (resolved && strcmp(resolved, target) == 0)
+            {
+                snprintf(stable, len, "%s", link);
+                found = 1;
+            }
+            free(resolved);
+        }
+        closedir(dirp);
+    }
+    free(target);
+#else
+    (void)link;
+#endif
+    if (!found)
+        snprintf(stable, len, "%s", device);
+    return found;
+}
+
+com_handle_t *com_open_path(const char *path, int baudrate_and_parity)
+{
+    com_handle_t *com = (com_handle_t *)malloc(sizeof(com_handle_t));
+    if (!com)
+        return NULL;
+    _DevicePath(path, com->path, sizeof(com->path));
+    com->handle = _OpenPort(com->path, baudrate_and_parity, &com->baudrate);
+    if (com->handle < 0)
+    {
+        free(com);
+        return NULL;
+    }
+    return com;
+}
+
+com_handle_t *com_open_path_low_latency(const char *path, int baudrate_and_parity, COMLatency *latency)
+{
+    com_handle_t *com = com_open_path(path, baudrate_and_parity);
+    if (!com)
+        return NULL;
+    // The sysfs latency timer is named after the device node, not a link to it
+    char port[COM_MAXPATH];
+    char *resolved = realpath(com->path, NULL);
+    const char *node = resolved ? resolved : com->path;
+    const char *slash = strrchr(node, '/');
+    snprintf(port, sizeof(port), "%s", slash ? slash + 1 : node);
+    free(resolved);
+    if (!_ConfigureLowLatency(com->handle, port, latency))
+    {
+        com_close(com);
+        return NULL;
+    }
+    return com;
+}
+
+void com_close(com_handle_t *com)
+{
+    if (!com)
+        return;
+    tcdrain(com->handle);
+    close(com->handle);
+    free(com);
+}
+
+int com_write(com_handle_t *com, const unsigned char *buffer, size_t len)
+{
+    int res = write(com->handle, buffer, len);
+    if (res < 0)
+        res = 0;
+    return res;
+}
+
+int com_read(com_handle_t *com, unsigned char *buffer, size_t len)
+{
+    int res = read(com->handle, buffer, len);
+    if (res < 0)
+        res = 0;
+    return res;
+}
+
+int com_read_blocking(com_handle_t *com, unsigned char *buffer, size_t len, unsigned timeout)
+{
+    // poll() rather than select(), which cannot watch descriptors above FD_SETSIZE
+    struct pollfd descriptor;
+    descriptor.fd = com->handle;
+    descriptor.events = POLLIN;
+    descriptor.revents = 0;
+    if (poll(&descriptor, 1, (int)timeout) <= 0)
+        return 0;
+    return com_read(com, buffer, len);
+}
+
+int com_read_until(com_handle_t *com, unsigned char *buffer, size_t len, size_t min_bytes, const struct timespec *timeout)
+{
+    struct timespec deadline, remaining;
+    if (min_bytes < 1)
+        min_bytes = 1;
+    if (min_bytes > len)
+        min_bytes = len;
+    if (timeout)
+    {
+        clock_gettime(CLOCK_MONOTONIC, &deadline);
+        deadline.tv_sec += timeout->tv_sec;
+        deadline.tv_nsec += timeout->tv_nsec;
+        if (deadline.tv_nsec >= 1000000000L)
+        {
+            deadline.tv_sec += deadline.tv_nsec / 1000000000L;
+            deadline.tv_nsec %= 1000000000L;
+        }
+    }
+
+    struct pollfd descriptor;
+    descriptor.fd = com->handle;
+    descriptor.events = POLLIN;
+    size_t received = 0;
+    while (received < min_bytes)
+    {
+        // Take everything available, not just the minimum, to save wakeups
+        ssize_t res = read(com->handle, buffer + received, len - received);
+        if (res > 0)
+        {
+            received += (size_t)res;
+            continue;
+        }
+        if (res == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR))
+            break;
+
+        if (timeout)
+        {
+            clock_gettime(CLOCK_MONOTONIC, &remaining);
+            remaining.tv_sec = deadline.tv_sec - remaining.tv_sec;
+            remaining.tv_nsec = deadline.tv_nsec - remaining.tv_nsec;
+            if (remaining.tv_nsec < 0)
+            {
+                remaining.tv_sec--;
+                remaining.tv_nsec += 1000000000L;
+            }
+            if (remaining.tv_sec < 0)
+                break;
+        }
+        descriptor.revents = 0;
+#if defined(__linux__)
+        int ready = ppoll(&descriptor, 1, timeout ? &remaining : NULL, NULL);
+#else
+        // poll() only has millisecond resolution, round up so the deadline is never cut short
+        int wait = timeout ? (int)(remaining.tv_sec * 1000 + (remaining.tv_nsec + 999999L) / 1000000L) : -1;
+        int ready = poll(&descriptor, 1, wait);
+#endif
+        if (ready < 0 && errno != EINTR)
+            break;
+        if (ready > 0 && !(descriptor.revents & POLLIN))
+            break; // Hung up or failed with nothing left to read
+    }
+    return (int)received;
+}
+
+int com_set_dtr(com_handle_t *com, int state)
+{
+    int flag = TIOCM_DTR;
+    return ioctl(com->handle, state ? TIOCMBIS : TIOCMBIC, &flag) != -1;
+}
+
+int com_set_rts(com_handle_t *com, int state)
+{
+    int flag = TIOCM_RTS;
+    return ioctl(com->handle, state ? TIOCMBIS : TIOCMBIC, &flag) != -1;
+}
+
+int com_get_baudrate(com_handle_t *com)
+{
+    return com->baudrate;
+}
+
+int com_get_fd(com_handle_t *com)
+{
+    return com->handle;
+}
+
+const char *com_get_path(com_handle_t *com)
+{
+    return com->path;
+}
+
 #endif // unix